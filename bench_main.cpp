@@ -0,0 +1,967 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <ctime>
+#include <algorithm>
+#include <cstring>
+
+#if STD //CREATE A REAL STL EXAMPLE
+	#include <deque>
+	#include <map>
+	#include <stack>
+	#include <vector>
+	namespace ft = std;
+#else
+	#include "btree_map.hpp"
+	#include "deque.hpp"
+	#include "flat_map.hpp"
+	#include "map.hpp"
+	#include "stack.hpp"
+	#include "vector.hpp"
+	#include "small_vector.hpp"
+	#include "unordered_map.hpp"
+	#include "utils/mmap_allocator.hpp"
+	#include <map>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <new>
+
+#define BENCH_OPS 200000
+#define MAX_RAM 4294967296
+#define BUFFER_SIZE 4096
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+//same map size as main_42.cpp
+#define COUNT2 (MAX_RAM / (int)sizeof(Buffer))
+
+//every allocation ends up here, pooled or not, whatever the form of
+//operator new. The block size is kept in a header in front of it to follow
+//the live bytes: only counted_alloc and counted_free see malloc's pointers,
+//the operators only ever handle the part after the header. They are kept out
+//of line so g++ never sees a delete-expression reach free() directly, which
+//-Wmismatched-new-delete would flag
+#define ALLOC_HEADER 16
+#if defined(__GNUC__)
+# define BENCH_NOINLINE __attribute__((noinline))
+#else
+# define BENCH_NOINLINE
+#endif
+static long	g_allocations = 0;
+static long	g_live_bytes = 0;
+static long	g_peak_bytes = 0;
+
+BENCH_NOINLINE static void	*counted_alloc( size_t size )
+{
+	char	*block = static_cast<char*>(malloc(size + ALLOC_HEADER));
+
+	if (!block)
+		throw std::bad_alloc();
+	g_allocations++;
+	*reinterpret_cast<size_t*>(block) = size;
+	g_live_bytes += size;
+	if (g_live_bytes > g_peak_bytes)
+		g_peak_bytes = g_live_bytes;
+	return (block + ALLOC_HEADER);
+}
+
+BENCH_NOINLINE static void	counted_free( void *ptr )
+{
+	if (!ptr)
+		return ;
+
+	void	*block = static_cast<char*>(ptr) - ALLOC_HEADER;
+
+	g_live_bytes -= *static_cast<size_t*>(block);
+	free(block);
+}
+
+#if __cplusplus >= 201103L
+void	*operator new( size_t size ) { return (counted_alloc(size)); }
+void	*operator new[]( size_t size ) { return (counted_alloc(size)); }
+void	operator delete( void *ptr ) noexcept { counted_free(ptr); }
+void	operator delete[]( void *ptr ) noexcept { counted_free(ptr); }
+void	operator delete( void *ptr, size_t ) noexcept { counted_free(ptr); }
+void	operator delete[]( void *ptr, size_t ) noexcept { counted_free(ptr); }
+#else
+void	*operator new( size_t size ) throw(std::bad_alloc) { return (counted_alloc(size)); }
+void	*operator new[]( size_t size ) throw(std::bad_alloc) { return (counted_alloc(size)); }
+void	operator delete( void *ptr ) throw() { counted_free(ptr); }
+void	operator delete[]( void *ptr ) throw() { counted_free(ptr); }
+#endif
+
+static double	elapsed_ns( clock_t start, long ops )
+{
+	return ((double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ops);
+}
+
+static void	print_line( std::string const & name, long n, double ns )
+{
+	std::cout << std::setw(28) << std::left << name;
+	std::cout << std::setw(10) << std::right << n << " keys ";
+	std::cout << std::setw(10) << std::fixed << std::setprecision(1) << ns << " ns/op" << std::endl;
+}
+
+//per-operation cost of insert and erase on a map that already holds n keys
+static void	bench_map_insert_erase( long n )
+{
+	ft::map<int, int>	map_int;
+	int					*keys = new int[BENCH_OPS];
+
+	while ((long)map_int.size() < n)
+		map_int.insert(ft::make_pair(rand(), 0));
+	for (int i = 0; i < BENCH_OPS; i++)
+		keys[i] = rand();
+
+	clock_t start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+		map_int.insert(ft::make_pair(keys[i], i));
+	print_line("map::insert", n, elapsed_ns(start, BENCH_OPS));
+
+	start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+		map_int.erase(keys[i]);
+	print_line("map::erase(key)", n, elapsed_ns(start, BENCH_OPS));
+	delete [] keys;
+}
+
+//"first key >= t" and equal_range lookups on a map of n random keys
+static void	bench_map_bounds( long n )
+{
+	ft::map<int, int>	map_int;
+	int					*keys = new int[BENCH_OPS];
+	long				sum = 0;
+
+	while ((long)map_int.size() < n)
+		map_int.insert(ft::make_pair(rand(), 0));
+	for (int i = 0; i < BENCH_OPS; i++)
+		keys[i] = rand();
+
+	clock_t start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+	{
+		ft::map<int, int>::iterator it = map_int.lower_bound(keys[i]);
+		if (it != map_int.end())
+			sum += it->first & 1;
+	}
+	print_line("map::lower_bound", n, elapsed_ns(start, BENCH_OPS));
+
+	start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+	{
+		ft::pair<ft::map<int, int>::iterator, ft::map<int, int>::iterator> range = map_int.equal_range(keys[i]);
+		sum += (range.first == range.second);
+	}
+	print_line("map::equal_range", n, elapsed_ns(start, BENCH_OPS));
+	std::cout << "checksum: " << sum << std::endl;
+	delete [] keys;
+}
+
+//replaying already sorted keys, with end() and with the previous insertion as hint
+static void	bench_map_sorted_load( long n )
+{
+	ft::map<int, int>	by_end;
+	ft::map<int, int>	by_prev;
+
+	clock_t start = clock();
+	for (long i = 0; i < n; i++)
+		by_end.insert(by_end.end(), ft::make_pair((int)i, 0));
+	print_line("map::insert(end(), v)", n, elapsed_ns(start, n));
+
+	ft::map<int, int>::iterator hint = by_prev.end();
+	start = clock();
+	for (long i = 0; i < n; i++)
+		hint = by_prev.insert(hint, ft::make_pair((int)i, 0));
+	print_line("map::insert(prev, v)", n, elapsed_ns(start, n));
+}
+
+//cold start from a sorted snapshot
+static void	bench_map_sorted_build( long n )
+{
+	ft::vector< ft::pair<int, int> >	snapshot;
+
+	for (long i = 0; i < n; i++)
+		snapshot.push_back(ft::make_pair((int)i, (int)i));
+
+	clock_t start = clock();
+	ft::map<int, int> map_int(snapshot.begin(), snapshot.end());
+	print_line("map(first, last) sorted", n, elapsed_ns(start, n));
+}
+
+//insert then find n keys, in random order and in ascending order
+static void	bench_map_find_insert( long n )
+{
+	ft::map<int, int>	random_map;
+	ft::map<int, int>	sequential_map;
+	int					*keys = new int[n];
+	long				sum = 0;
+
+	for (long i = 0; i < n; i++)
+		keys[i] = rand();
+
+	clock_t start = clock();
+	for (long i = 0; i < n; i++)
+		random_map.insert(ft::make_pair(keys[i], 0));
+	print_line("map::insert random", n, elapsed_ns(start, n));
+	start = clock();
+	for (long i = 0; i < n; i++)
+		sequential_map.insert(ft::make_pair((int)i, 0));
+	print_line("map::insert sequential", n, elapsed_ns(start, n));
+
+	start = clock();
+	for (long i = 0; i < n; i++)
+		sum += (random_map.find(keys[i]) != random_map.end());
+	print_line("map::find random", n, elapsed_ns(start, n));
+	start = clock();
+	for (long i = 0; i < n; i++)
+		sum += (sequential_map.find((int)i) != sequential_map.end());
+	print_line("map::find sequential", n, elapsed_ns(start, n));
+	std::cout << "checksum: " << sum << std::endl;
+	delete [] keys;
+}
+
+//full in-order scan, with the end() check done on every step
+static void	bench_map_iterate( long n )
+{
+	ft::map<std::string, int>	map_str;
+	long						sum = 0;
+
+	for (long i = 0; i < n; i++)
+	{
+		char	key[64];
+		sprintf(key, "some/long/common/prefix/%ld", (long)rand());
+		map_str.insert(ft::make_pair(std::string(key), (int)i));
+	}
+
+	clock_t start = clock();
+	for (ft::map<std::string, int>::iterator it = map_str.begin(); it != map_str.end(); it++)
+		sum += it->second;
+	print_line("map<string>::iterator++", n, elapsed_ns(start, map_str.size()));
+
+	start = clock();
+	for (ft::map<std::string, int>::reverse_iterator it = map_str.rbegin(); it != map_str.rend(); it++)
+		sum -= it->second;
+	print_line("map<string>::reverse_it++", n, elapsed_ns(start, map_str.size()));
+	std::cout << "checksum: " << sum << std::endl;
+}
+
+//deep copy then teardown of a map of n random keys, as main_42.cpp does
+static void	bench_map_copy( long n )
+{
+	ft::map<int, int>	map_int;
+
+	while ((long)map_int.size() < n)
+		map_int.insert(ft::make_pair(rand(), rand()));
+
+	clock_t start = clock();
+	{
+		ft::map<int, int> copy = map_int;
+		print_line("map(const map&)", n, elapsed_ns(start, n));
+		start = clock();
+	}
+	print_line("~map()", n, elapsed_ns(start, n));
+	start = clock();
+	map_int.clear();
+	print_line("map::clear()", n, elapsed_ns(start, n));
+}
+
+//main_42.cpp's map workload: n random keys, then operator[] on random keys
+//(mostly misses, they insert), find on keys that are there, and a copy.
+//Every container gets the same keys
+template <class Map>
+static void	bench_random_keys( std::string const & name, long n )
+{
+	Map		table;
+	long	base = g_live_bytes;
+	long	sum = 0;
+
+	srand(42);
+	clock_t start = clock();
+	for (long i = 0; i < n; i++)
+	{
+		int	key = rand();
+
+		table.insert(typename Map::value_type(key, rand()));
+	}
+	print_line(name + " insert", n, elapsed_ns(start, n));
+	std::cout << std::setw(28) << std::left << "" << "heap bytes per key: " << (g_live_bytes - base) / (long)table.size() << std::endl;
+	start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+		sum += table[rand()];
+	print_line(name + "[]", n, elapsed_ns(start, BENCH_OPS));
+	srand(42);
+	start = clock();
+	for (long i = 0; i < n; i++)
+	{
+		sum += (table.find(rand()) != table.end());
+		rand();
+	}
+	print_line(name + "::find hit", n, elapsed_ns(start, n));
+	start = clock();
+	{
+		Map	copy(table);
+
+		sum += copy.size();
+		print_line(name + " copy", n, elapsed_ns(start, n));
+	}
+	if (sum < n)
+		std::cout << "random keys went missing" << std::endl;
+}
+
+static void	print_allocations( long allocations )
+{
+	std::cout << std::setw(28) << std::left << "" << "operator new calls: " << g_allocations - allocations << std::endl;
+}
+
+//insert / erase churn around a steady n keys, counting trips to operator new
+template <class Map>
+static void	bench_map_churn( std::string const & name, long n )
+{
+	Map		map_int;
+	long	allocations;
+
+	while ((long)map_int.size() < n)
+		map_int.insert(ft::make_pair(rand(), 0));
+	allocations = g_allocations;
+
+	clock_t start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+	{
+		map_int.insert(ft::make_pair(rand(), i));
+		map_int.erase(map_int.begin());
+	}
+	print_line(name, n, elapsed_ns(start, BENCH_OPS));
+	print_allocations(allocations);
+}
+
+//push_back growth and front insertion, every reallocation moves the whole content
+template <class T>
+static void	bench_vector_growth( std::string const & name, long n, T const & val )
+{
+	clock_t start = clock();
+	{
+		ft::vector<T>	vec;
+
+		for (long i = 0; i < n; i++)
+			vec.push_back(val);
+		print_line(name + "::push_back", n, elapsed_ns(start, n));
+		start = clock();
+		for (int i = 0; i < 100; i++)
+			vec.insert(vec.begin(), val);
+		print_line(name + "::insert(begin())", n, elapsed_ns(start, 100));
+	}
+}
+
+//splicing a batch of n elements in the middle of a vector, then reloading it whole
+static void	bench_vector_range( long n )
+{
+	ft::vector<int>	batch;
+	ft::vector<int>	vec(1000, 0);
+
+	for (long i = 0; i < n; i++)
+		batch.push_back(rand());
+
+	clock_t start = clock();
+	vec.insert(vec.begin() + vec.size() / 2, batch.begin(), batch.end());
+	print_line("vector::insert(pos, f, l)", n, elapsed_ns(start, n));
+	start = clock();
+	for (int i = 0; i < 10; i++)
+		vec.assign(batch.begin(), batch.end());
+	print_line("vector::assign(f, l)", n, elapsed_ns(start, n * 10));
+}
+
+//string-heavy workloads: rows of strings pushed, regrown and filed in a map.
+//The C++98 build copies everywhere, the C++11 build moves where it can
+//a buffer sized then filled by a read(), value-initialized or not, and
+//assign(n, 0) over memory already mapped
+static void	bench_vector_buffer( long n )
+{
+	ft::vector<int>	zeros(n, 1);
+
+	clock_t start = clock();
+	for (int i = 0; i < 10; i++)
+		zeros.assign(n, 0);
+	print_line("vector<int>::assign(n, 0)", n, elapsed_ns(start, n * 10));
+	start = clock();
+	{
+		ft::vector<char>	buf;
+
+		buf.resize(n);
+		std::memset(&buf[0], 'r', n);
+		print_line("vector<char> resize + read", n, elapsed_ns(start, n));
+	}
+#if !STD
+	start = clock();
+	{
+		ft::vector<char>	buf;
+
+		buf.resize_uninitialized(n);
+		std::memset(&buf[0], 'r', n);
+		print_line("resize_uninitialized + read", n, elapsed_ns(start, n));
+	}
+#endif
+}
+
+static bool	is_dropped( int x ) { return (x % 10 < 3); }
+
+//drops about 30% of a vector<int>: erase_if against erase() in a loop
+static void	bench_vector_filter( long n )
+{
+	ft::vector<int>	vec;
+
+	for (long i = 0; i < n; i++)
+		vec.push_back(rand());
+
+	ft::vector<int>	copy(vec);
+
+	clock_t start = clock();
+#if STD && __cplusplus < 202002L
+	vec.erase(std::remove_if(vec.begin(), vec.end(), is_dropped), vec.end());
+#else
+	ft::erase_if(vec, is_dropped);
+#endif
+	print_line("vector erase_if 30%", n, elapsed_ns(start, n));
+	if (n > 100000) //quadratic
+		return ;
+	start = clock();
+	for (ft::vector<int>::iterator it = copy.begin(); it != copy.end();)
+	{
+		if (is_dropped(*it))
+			it = copy.erase(it);
+		else
+			++it;
+	}
+	print_line("vector erase() loop 30%", n, elapsed_ns(start, n));
+	if (copy != vec)
+		std::cout << "erase_if and erase() disagree" << std::endl;
+}
+
+//== and < on two equal vectors but for the last element, the worst case
+template <class T>
+static void	bench_vector_compare( std::string const & name, long n )
+{
+	ft::vector<T>	a;
+
+	for (long i = 0; i < n; i++)
+		a.push_back(static_cast<T>(i % 100));
+
+	ft::vector<T>	b(a);
+	int				hits = 0;
+
+	b.back() = static_cast<T>(101);
+
+	clock_t start = clock();
+	for (int i = 0; i < 100; i++)
+		hits += (a == b);
+	print_line(name + " ==", n, elapsed_ns(start, n * 100));
+	start = clock();
+	for (int i = 0; i < 100; i++)
+		hits += (a < b);
+	print_line(name + " <", n, elapsed_ns(start, n * 100));
+	if (hits != 100)
+		std::cout << "unexpected compare result" << std::endl;
+}
+
+static void	bench_string_moves( long n )
+{
+	ft::vector<std::string>	row;
+	long					allocations;
+
+	for (int i = 0; i < 8; i++)
+		row.push_back(std::string(40, 'a' + i));
+
+	{
+		ft::vector< ft::vector<std::string> >	table;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+		{
+			ft::vector<std::string> tmp(row);
+			table.push_back(tmp);
+		}
+		print_line("vector<vector<string>> copy", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+#if __cplusplus >= 201103L
+	{
+		ft::vector< ft::vector<std::string> >	table;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+		{
+			ft::vector<std::string> tmp(row);
+			table.push_back(std::move(tmp));
+		}
+		print_line("vector<vector<string>> move", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+#endif
+
+	ft::vector<std::string>	keys;
+
+	for (long i = 0; i < n; i++)
+	{
+		char	key[64];
+		sprintf(key, "some/long/common/prefix/%ld", (long)rand());
+		keys.push_back(key);
+	}
+	{
+		ft::map< std::string, ft::vector<std::string> >	index;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+			index.insert(ft::make_pair(keys[i], row));
+		print_line("map::insert(make_pair) copy", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+#if __cplusplus >= 201103L
+	{
+		ft::map< std::string, ft::vector<std::string> >	index;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+			index.emplace(keys[i], row);
+		print_line("map::emplace", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+#endif
+#if (__cplusplus >= 201103L && !STD) || __cplusplus >= 201703L
+	{
+		ft::map< std::string, ft::vector<std::string> >	index;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+			index.try_emplace(keys[i], row);
+		print_line("map::try_emplace", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+#endif
+	{
+		ft::stack<std::string>	stack;
+
+		allocations = g_allocations;
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+			stack.push(keys[i] + "/leaf");
+		print_line("stack<string>::push", n, elapsed_ns(start, n));
+		print_allocations(allocations);
+	}
+}
+
+//short-lived containers of k elements, built and dropped BENCH_OPS times
+template <class Vector>
+static void	bench_short_lived( std::string const & name, int k )
+{
+	long	allocations = g_allocations;
+	long	sum = 0;
+
+	clock_t start = clock();
+	for (int i = 0; i < BENCH_OPS; i++)
+	{
+		Vector	vec;
+
+		for (int j = 0; j < k; j++)
+			vec.push_back(i + j);
+		sum += vec[k - 1];
+	}
+	print_line(name, k, elapsed_ns(start, BENCH_OPS));
+	print_allocations(allocations);
+	std::cout << "checksum: " << sum << std::endl;
+}
+
+#if !STD
+//push_back of n Buffer as main_42.cpp does: time, peak heap and the slack
+//left once done, before and after shrink_to_fit
+template <class Growth>
+static void	bench_growth_policy( std::string const & name, long n, bool reserved = false )
+{
+	ft::vector<Buffer, std::allocator<Buffer>, Growth>	vec;
+	Buffer												buffer;
+
+	buffer.idx = 0;
+	g_peak_bytes = g_live_bytes;
+
+	long	base = g_live_bytes;
+	long	allocations = g_allocations;
+
+	clock_t start = clock();
+	if (reserved)
+		vec.reserve_exact(n);
+	for (long i = 0; i < n; i++)
+		vec.push_back(buffer);
+	print_line(name, n, elapsed_ns(start, n));
+	print_allocations(allocations);
+	std::cout << std::setw(28) << std::left << "" << "peak MB: " << (g_peak_bytes - base) / 1048576;
+	std::cout << ", capacity: " << vec.capacity();
+	vec.shrink_to_fit();
+	std::cout << ", after shrink_to_fit: " << vec.capacity() << std::endl;
+}
+
+//peak resident set of the process, reset between runs. Linux only,
+//the mappings of mmap_allocator never reach the operator new counters
+static void	reset_peak_rss( void )
+{
+#ifdef __linux__
+	FILE	*f = fopen("/proc/self/clear_refs", "w");
+
+	if (f)
+	{
+		fputs("5", f);
+		fclose(f);
+	}
+#endif
+}
+
+static long	peak_rss_mb( void )
+{
+	long	kb = -1;
+#ifdef __linux__
+	FILE	*f = fopen("/proc/self/status", "r");
+	char	line[256];
+
+	if (!f)
+		return (-1);
+	while (fgets(line, sizeof(line), f))
+		if (sscanf(line, "VmHWM: %ld kB", &kb) == 1)
+			break ;
+	fclose(f);
+#endif
+	return (kb < 0 ? -1 : kb / 1024);
+}
+
+//push_back up to mb megabytes of long: time and peak RSS of the growth,
+//copying reallocations against mremap. Untouched pages are not resident so
+//the copy shows in the heap peak (address space to commit) more than in RSS
+template <class Alloc>
+static void	bench_large_growth( std::string const & name, long mb )
+{
+	long	n = mb * 1048576 / (long)sizeof(long);
+
+	reset_peak_rss();
+	g_peak_bytes = g_live_bytes;
+	{
+		ft::vector<long, Alloc>	vec;
+		long					base = g_live_bytes;
+
+		clock_t start = clock();
+		for (long i = 0; i < n; i++)
+			vec.push_back(i);
+		print_line(name, n, elapsed_ns(start, n));
+		std::cout << std::setw(28) << std::left << "" << "vector MB: " << mb;
+		std::cout << ", peak RSS MB: " << peak_rss_mb();
+		std::cout << ", peak heap MB: " << (g_peak_bytes - base) / 1048576 << std::endl;
+	}
+}
+#endif
+
+//a deep stack of Buffer: time and peak heap of the pushes, then the pops
+template <class Container>
+static void	bench_stack_growth( std::string const & name, long n )
+{
+	ft::stack<Buffer, Container>	stack;
+	Buffer							buffer;
+	long							base = g_live_bytes;
+
+	buffer.idx = 0;
+	g_peak_bytes = g_live_bytes;
+
+	clock_t start = clock();
+	for (long i = 0; i < n; i++)
+		stack.push(buffer);
+	print_line(name + " push", n, elapsed_ns(start, n));
+	std::cout << std::setw(28) << std::left << "" << "peak MB: " << (g_peak_bytes - base) / 1048576
+		<< ", live MB: " << (g_live_bytes - base) / 1048576 << std::endl;
+	start = clock();
+	while (!stack.empty())
+		stack.pop();
+	print_line(name + " pop", n, elapsed_ns(start, n));
+}
+
+#if !STD
+//a bitmap as vector<bool> against one byte per flag: memory, then count,
+//find of the only set flag and flip over the whole of it
+static void	bench_bitmap( long n )
+{
+	ft::vector<bool>			bits;
+	ft::vector<unsigned char>	bytes;
+	long						base = g_live_bytes;
+
+	for (long i = 0; i < n; i++)
+		bits.push_back(i % 3 == 0);
+	std::cout << std::setw(28) << std::left << "vector<bool> bitmap" << std::setw(10) << std::right << n
+		<< " flags " << (g_live_bytes - base) / 1048576 << " MB" << std::endl;
+	base = g_live_bytes;
+	for (long i = 0; i < n; i++)
+		bytes.push_back(i % 3 == 0);
+	std::cout << std::setw(28) << std::left << "vector<unsigned char> flags" << std::setw(10) << std::right << n
+		<< " flags " << (g_live_bytes - base) / 1048576 << " MB" << std::endl;
+
+	long	found = 0;
+
+	clock_t start = clock();
+	found += bits.count();
+	print_line("vector<bool>::count", n, elapsed_ns(start, n));
+	start = clock();
+	found += std::count(bytes.begin(), bytes.end(), 1);
+	print_line("std::count on bytes", n, elapsed_ns(start, n));
+
+	bits.assign(n, false);
+	bits.back() = true;
+	bytes.assign(n, 0);
+	bytes.back() = 1;
+	start = clock();
+	found += bits.find_first();
+	print_line("vector<bool>::find_first", n, elapsed_ns(start, n));
+	start = clock();
+	found += std::find(bytes.begin(), bytes.end(), 1) - bytes.begin();
+	print_line("std::find on bytes", n, elapsed_ns(start, n));
+
+	ft::vector<bool>	mask(n, true);
+
+	start = clock();
+	bits.flip();
+	bits &= mask;
+	print_line("vector<bool> flip + &=", n, elapsed_ns(start, n));
+	start = clock();
+	for (long i = 0; i < n; i++)
+		bytes[i] = !bytes[i];
+	print_line("bytes flip", n, elapsed_ns(start, n));
+	if (found != 2 * ((n + 2) / 3) + 2 * (n - 1))
+		std::cout << "bitmap scans disagree" << std::endl;
+}
+
+//a read-mostly table of n random keys: heap taken, build, then find and
+//lower_bound throughput, for the tree and the sorted vector
+template <class Map>
+static void	bench_lookup_table( std::string const & name, long n )
+{
+	ft::vector< ft::pair<int, int> >	input;
+	ft::vector<int>						keys;
+	long								hits = 0;
+
+	for (long i = 0; i < n; i++)
+		input.push_back(ft::make_pair(rand(), (int)i));
+	for (int i = 0; i < BENCH_OPS; i++)
+		keys.push_back(i % 2 ? input[rand() % n].first : rand());
+
+	long	base = g_live_bytes;
+
+	clock_t start = clock();
+	{
+		Map	table(input.begin(), input.end());
+
+		print_line(name + " build", n, elapsed_ns(start, n));
+		std::cout << std::setw(28) << std::left << "" << "heap bytes per key: " << (g_live_bytes - base) / (long)table.size() << std::endl;
+		start = clock();
+		for (int i = 0; i < BENCH_OPS; i++)
+			hits += (table.find(keys[i]) != table.end());
+		print_line(name + "::find", n, elapsed_ns(start, BENCH_OPS));
+		start = clock();
+		for (int i = 0; i < BENCH_OPS; i++)
+			hits += (table.lower_bound(keys[i]) != table.end());
+		print_line(name + "::lower_bound", n, elapsed_ns(start, BENCH_OPS));
+	}
+	if (hits < BENCH_OPS / 2)
+		std::cout << "lookup table lost keys" << std::endl;
+}
+
+//percentile queries on a map of n random keys: nth, rank and
+//count_range against walking the iterators
+static void	bench_map_order_statistics( long n )
+{
+	ft::map<int, int>	table;
+	long				sum = 0;
+	int					queries = 1000;
+
+	while ((long)table.size() < n)
+		table.insert(ft::make_pair(rand(), rand()));
+
+	clock_t start = clock();
+	for (int i = 0; i < queries; i++)
+		sum += table.nth(table.size() * (i % 100) / 100)->first;
+	print_line("map::nth", n, elapsed_ns(start, queries));
+	if (n <= 100000)
+	{
+		start = clock();
+		for (int i = 0; i < queries; i++)
+		{
+			ft::map<int, int>::iterator	it = table.begin();
+
+			std::advance(it, table.size() * (i % 100) / 100);
+			sum -= it->first;
+		}
+		print_line("map advance to nth", n, elapsed_ns(start, queries));
+	}
+	start = clock();
+	for (int i = 0; i < queries; i++)
+		sum += table.rank(rand());
+	print_line("map::rank", n, elapsed_ns(start, queries));
+	start = clock();
+	for (int i = 0; i < queries; i++)
+	{
+		int	lo = rand();
+
+		sum += table.count_range(lo, lo + RAND_MAX / 100);
+	}
+	print_line("map::count_range", n, elapsed_ns(start, queries));
+	std::cout << "checksum: " << sum << std::endl;
+}
+
+//range queries over n random keys: lower_bound then the next 100 values,
+//and one full in-order scan
+template <class Map>
+static void	bench_range_scan( std::string const & name, long n )
+{
+	Map		table;
+	long	sum = 0;
+	int		scans = BENCH_OPS / 100;
+
+	srand(42);
+	while ((long)table.size() < n)
+		table.insert(ft::make_pair(rand(), rand()));
+
+	clock_t start = clock();
+	for (int i = 0; i < scans; i++)
+	{
+		typename Map::iterator it = table.lower_bound(rand());
+
+		for (int j = 0; j < 100 && it != table.end(); j++, ++it)
+			sum += it->second;
+	}
+	print_line(name + " scan 100", n, elapsed_ns(start, scans));
+	start = clock();
+	for (typename Map::iterator it = table.begin(); it != table.end(); ++it)
+		sum -= it->second;
+	print_line(name + "::iterator++", n, elapsed_ns(start, n));
+	std::cout << "checksum: " << sum << std::endl;
+}
+#endif
+
+int main(int argc, char** argv) {
+	long max_keys = 1000000;
+	long max_vector_mb = 1024;
+
+	if (argc > 1)
+		max_keys = atol(argv[1]);
+	if (argc > 2)
+		max_vector_mb = atol(argv[2]);
+	srand(42);
+#if STD
+	(void)max_vector_mb;
+	std::cout << "STD" << std::endl;
+#else
+	std::cout << "FT" << std::endl;
+#endif
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_insert_erase(n);
+	for (long n = 1000; n < COUNT2; n *= 10)
+		bench_map_bounds(n);
+	bench_map_bounds(COUNT2);
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_sorted_load(n);
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_sorted_build(n);
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_find_insert(n);
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_iterate(n);
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_map_copy(n);
+	for (long n = 1000; n < COUNT2; n *= 10)
+	{
+		bench_random_keys< ft::map<int, int> >("map", n);
+#if !STD
+		bench_random_keys< std::map<int, int> >("std::map", n);
+		bench_random_keys< ft::unordered_map<int, int> >("unordered_map", n);
+		bench_random_keys< ft::btree_map<int, int> >("btree_map", n);
+#endif
+	}
+	bench_random_keys< ft::map<int, int> >("map", COUNT2);
+#if !STD
+	bench_random_keys< std::map<int, int> >("std::map", COUNT2);
+	bench_random_keys< ft::unordered_map<int, int> >("unordered_map", COUNT2);
+	bench_random_keys< ft::btree_map<int, int> >("btree_map", COUNT2);
+#endif
+	for (long n = 1000; n <= max_keys; n *= 10)
+	{
+		bench_map_churn< ft::map<int, int> >("map churn std::allocator", n);
+#if !STD
+		bench_map_churn< ft::map<int, int, ft::less<int>, ft::node_pool_allocator< ft::pair<const int, int> > > >("map churn node_pool", n);
+#endif
+	}
+	for (long n = 1000; n <= max_keys; n *= 10)
+	{
+		bench_vector_growth<int>("vector<int>", n, 42);
+		bench_vector_growth< ft::pair<int, int> >("vector<pair<int,int>>", n, ft::make_pair(4, 2));
+		bench_vector_growth<std::string>("vector<string>", n, "not relocatable");
+	}
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_vector_range(n);
+	for (long n = 1000; n <= max_keys * 10; n *= 10)
+		bench_vector_filter(n);
+	for (long n = 1000000; n <= max_keys * 100; n *= 10)
+		bench_vector_buffer(n);
+	for (long n = 1000; n <= max_keys; n *= 10)
+	{
+		bench_vector_compare<int>("vector<int>", n);
+		bench_vector_compare<unsigned char>("vector<unsigned char>", n);
+		bench_vector_compare<float>("vector<float>", n);
+		bench_vector_compare<double>("vector<double>", n);
+	}
+	for (long n = 1000; n <= max_keys; n *= 10)
+		bench_string_moves(n);
+#if !STD
+	for (long n = 1000; n <= 100000; n *= 10)
+	{
+		bench_growth_policy<ft::growth_double>("vector<Buffer> growth 2x", n);
+		bench_growth_policy<ft::growth_one_and_half>("vector<Buffer> growth 1.5x", n);
+		if (n <= 1000) //quadratic
+			bench_growth_policy<ft::growth_exact>("vector<Buffer> growth exact", n);
+		bench_growth_policy<ft::growth_double>("vector<Buffer> reserve_exact", n, true);
+	}
+	for (long mb = 256; mb <= max_vector_mb; mb *= 2)
+	{
+		bench_large_growth< std::allocator<long> >("vector<long> std::allocator", mb);
+		bench_large_growth< ft::mmap_allocator<long> >("vector<long> mmap_allocator", mb);
+	}
+#endif
+	for (long n = 1000; n <= 100000; n *= 10)
+	{
+		bench_stack_growth< ft::vector<Buffer> >("stack<Buffer, vector>", n);
+		bench_stack_growth< ft::deque<Buffer> >("stack<Buffer, deque>", n);
+	}
+#if !STD
+	bench_bitmap(max_keys * 100);
+	for (long n = 1000; n <= max_keys * 10; n *= 10)
+	{
+		bench_lookup_table< ft::map<int, int> >("map table", n);
+		bench_lookup_table< ft::flat_map<int, int> >("flat_map table", n);
+		bench_lookup_table< ft::btree_map<int, int> >("btree_map table", n);
+	}
+	for (long n = 1000; n <= max_keys; n *= 10)
+	{
+		bench_range_scan< ft::map<int, int> >("map", n);
+		bench_range_scan< ft::btree_map<int, int> >("btree_map", n);
+	}
+	for (long n = 1000; n <= max_keys * 10; n *= 10)
+		bench_map_order_statistics(n);
+#endif
+	for (int k = 1; k <= 16; k *= 2)
+	{
+		bench_short_lived< ft::vector<int> >("vector<int>", k);
+#if !STD
+		bench_short_lived< ft::small_vector<int, 8> >("small_vector<int, 8>", k);
+#endif
+	}
+	return (0);
+}
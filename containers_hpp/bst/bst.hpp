@@ -9,6 +9,13 @@
 
 namespace ft{
 
+#if __cplusplus >= 201103L
+//node constructors for emplace (elem built from the arguments) and
+//try_emplace (elem built from a key and the mapped value's arguments)
+struct bst_emplace_tag {};
+struct bst_try_emplace_tag {};
+#endif
+
 template <class pair_type, class key_compare>
 struct BST
 {
@@ -21,222 +28,188 @@ struct BST
 	typedef typename allocator_type::const_reference					const_reference;
 	typedef typename allocator_type::difference_type					difference_type;
 
-	key_compare		cmp;
-	allocator_type	allocker;
-
 	pair_type		elem;
 	pointer			left;
 	pointer 		right;
 	pointer			parent;
+	int				height;
+	//nodes in the subtree rooted here, this one included
+	std::size_t		weight;
+
+	//comparator and allocator belong to the map, nodes only hold their links
+	BST( pair_type const & new_pair ) : elem(new_pair), left(NULL), right(NULL), parent(NULL), height(1), weight(1) {}
+	BST( BST<pair_type, key_compare> const & src ) : elem(src.elem), left(NULL), right(NULL), parent(NULL), height(src.height), weight(src.weight) {}
+#if __cplusplus >= 201103L
+	template <class... Args>
+	BST( bst_emplace_tag, Args&&... args ) : elem(std::forward<Args>(args)...), left(NULL), right(NULL), parent(NULL), height(1), weight(1) {}
+
+	template <class K, class... Args>
+	BST( bst_try_emplace_tag, K && key, Args&&... args ) : elem(std::forward<K>(key), value_type(std::forward<Args>(args)...)), left(NULL), right(NULL), parent(NULL), height(1), weight(1) {}
+#endif
+	~BST( void ) {}
 
-	struct balance_factor{
-		balance_factor( void ) : balance(0), left(0), right(0) {}
-		balance_factor( balance_factor const & src) : balance(src.balance), left(src.left), right(src.right) {}
-		int balance;
-		int	left;
-		int	right;
-	};
+#if __cplusplus >= 201103L
+	//the node is built in place, allocator_traits falls back on
+	//placement new for allocators without a variadic construct
+	template <class Alloc, class... Args>
+	static pointer	create_node( Alloc & allocker, Args&&... args )
+	{
+		pointer new_node = allocker.allocate(1);
 
-	balance_factor depth;
+		std::allocator_traits<Alloc>::construct(allocker, new_node, std::forward<Args>(args)...);
+		return new_node;
+	}
+#else
+	template <class Alloc>
+	static pointer	create_node( Alloc & allocker, pair_type const & pair )
+	{
+		pointer new_node = allocker.allocate(1);
 
-	BST( pair_type new_pair ) : elem(new_pair), left(NULL), right(NULL), parent(NULL), depth() {}
-	BST( BST<pair_type, key_compare> const & src ) : elem(src.elem), left(NULL), right(NULL), parent(NULL), depth(src.depth) {
-		if (src.left != NULL)
-		{
-			left = allocker.allocate(1);
-			allocker.construct(left, *src.left);
-			left->parent = this;
-		}
-		if (src.right != NULL)
-		{
-			right = allocker.allocate(1);
-			allocker.construct(right, *src.right);
-			right->parent = this;
-		}
+		allocker.construct(new_node, BST<pair_type, key_compare>(pair));
+		return new_node;
 	}
-	~BST( void ) {
-		destroy_sub_pointers();
+#endif
+
+	//the caller rebalances from the new leaf's parent up to the root
+	void	attach_leaf( pointer leaf, bool on_left )
+	{
+		leaf->parent = this;
+		if (on_left)
+			left = leaf;
+		else
+			right = leaf;
 	}
 
-	reference operator=( BST<pair_type, key_compare> const & src )
+	template <class Alloc>
+	pointer	insert_leaf( pair_type const & pair, bool on_left, Alloc & allocker )
 	{
-		if (this != &src)
+		pointer leaf = create_node(allocker, pair);
+
+		attach_leaf(leaf, on_left);
+		return leaf;
+	}
+
+	//one comparison per level: the last node we went right from is the
+	//only one that can hold an equivalent key, it is checked once at the end.
+	//returns that node and false, or the parent of the missing leaf and true
+	ft::pair<pointer, bool>	find_leaf_slot( key_type const & key, key_compare const & cmp, bool & on_left )
+	{
+		pointer	node = this;
+		pointer	parent = this;
+		pointer	candidate = NULL;
+
+		on_left = true;
+		while (node)
 		{
-			elem = src.elem;
-			depth =  src.depth;
-			destroy_sub_pointers();
-			if (src.left != NULL)
-			{
-				left = allocker.allocate(1);
-				allocker.construct(left, *src.left);
-			}
-			if (src.right != NULL)
+			parent = node;
+			on_left = cmp(key, node->elem.first);
+			if (on_left)
+				node = node->left;
+			else
 			{
-				right = allocker.allocate(1);
-				allocker.construct(right, *src.right);
+				candidate = node;
+				node = node->right;
 			}
 		}
-		return (*this);
+		if (candidate && !cmp(candidate->elem.first, key))
+			return (ft::make_pair(candidate, false));
+		return (ft::make_pair(parent, true));
 	}
 
-	void	destroy_sub_pointers( void )
+	template <class Alloc>
+	ft::pair<pointer, bool> insert( pair_type const & pair, key_compare const & cmp, Alloc & allocker )
 	{
-		destroy_pointer(this->left, allocker);
-		destroy_pointer(this->right, allocker);
+		bool					on_left;
+		ft::pair<pointer, bool>	slot = find_leaf_slot(pair.first, cmp, on_left);
+
+		if (!slot.second)
+			return (slot);
+		return (ft::make_pair(slot.first->insert_leaf(pair, on_left, allocker), true));
 	}
 
-	pointer create_leaf(pair_type const & pair)
+	pointer	find_start( void )
 	{
-		pointer new_leaf;
-		new_leaf = allocker.allocate(1);
-		allocker.construct(new_leaf, BST<pair_type, key_compare>(pair));
-		return new_leaf;
-	}
+		pointer	node = this;
 
-	bool compare( pair_type const & pair ) { return cmp(pair.first, elem.first); }
+		while (node->left)
+			node = node->left;
+		return node;
+	}
 
-	void	recursive_balancing( void )
+	pointer	find_end( void )
 	{
-		if (this->left)
-		{
-			left->parent = this;
-			left->recursive_balancing();
-		}
-		if (this->right)
-		{
-			right->parent = this;
-			right->recursive_balancing();
-		}
-		balance(this);
+		pointer	node = this;
+
+		while (node->right)
+			node = node->right;
+		return node;
 	}
 
-	ft::pair<pointer, bool> insert( pair_type const & pair )
+	//first node whose key is not less than key, NULL if there is none
+	pointer	lower_bound( key_type const & key, key_compare const & cmp )
 	{
-		ft::pair<pointer, bool> ret;
-		if (compare(pair))
+		pointer	node = this;
+		pointer	ret = NULL;
+
+		while (node)
 		{
-			if (this->left != NULL)
-				ret = left->insert(pair);
-			else
+			if (!cmp(node->elem.first, key))
 			{
-				left = create_leaf(pair);
-				ret.first = left;
-				ret.second = true;
+				ret = node;
+				node = node->left;
 			}
-		}
-		else
-		{
-			if (pair.first == this->elem.first)
-				return (ft::make_pair(this, false));
-			if (this->right != NULL)
-				ret = right->insert(pair);
 			else
-			{
-				right = create_leaf(pair);
-				ret.first = right;
-				ret.second = true;
-			}
+				node = node->right;
 		}
-		balance(this->left);
-		balance(this->right);
-		left = rotate(this->left);
-		right = rotate(this->right);
-		if (left)
-			left->parent = this;
-		if (right)	
-			right->parent = this;
 		return ret;
 	}
 
-	pointer	copy_this( void )
+	//first node whose key is greater than key, NULL if there is none
+	pointer	upper_bound( key_type const & key, key_compare const & cmp )
 	{
-		pointer tmp;
-		tmp = allocker.allocate(1);
-		allocker.construct(tmp, *this);
-		return tmp;
-	}
+		pointer	node = this;
+		pointer	ret = NULL;
 
-	int	erase_elem( key_type key)
-	{
-		int ret = 0;
-		if (cmp(key, this->elem.first))
+		while (node)
 		{
-			if (left)
+			if (cmp(key, node->elem.first))
 			{
-				if (key == left->elem.first)
-				{
-					left = destroy(left);
-					balance(left);
-					left = rotate(left);
-					ret = 1;
-				}
-				else
-					ret = left->erase_elem(key);
+				ret = node;
+				node = node->left;
 			}
-		}
-		else
-		{
-			if (right)
-			{
-				if (key == right->elem.first)
-				{	
-					right = destroy(right);
-					balance(right);
-					right = rotate(right);
-					ret = 1;
-				}
-				else
-					ret = right->erase_elem(key);
-			}
-		}
-		if (ret)
-		{
-			balance(this->left);
-			balance(this->right);
-			left = rotate(this->left);
-			right = rotate(this->right);
-			if (left)
-				left->parent = this;
-			if (right)	
-				right->parent = this;
+			else
+				node = node->right;
 		}
 		return ret;
 	}
 
-	pointer	find_start( void )
-	{
-		if (this->left)
-			return (left->find_start());
-		else
-			return this;
-	}
-
-	pointer	find_end( void )
+	//number of keys less than key, counted on the way down
+	std::size_t	count_less( key_type const & key, key_compare const & cmp )
 	{
-		if (this->right)
-			return (right->find_end());
-		else
-			return (this);
-	}
+		pointer		node = this;
+		std::size_t	n = 0;
 
-	pointer find_by_key( key_type const & key )
-	{
-		if (cmp(key, this->elem.first))
+		while (node)
 		{
-			if (left)
-				return (left->find_by_key(key));
-			else
-				return NULL;
-		}
-		else
-		{
-			if (key == this->elem.first)
-				return this;
-			else if (right)
-				return (right->find_by_key(key));
+			if (cmp(node->elem.first, key))
+			{
+				n += subtree_weight(node->left) + 1;
+				node = node->right;
+			}
 			else
-				return NULL;
+				node = node->left;
 		}
+		return n;
+	}
+
+	//equivalence under cmp only, key_type does not need operator==
+	pointer find_by_key( key_type const & key, key_compare const & cmp )
+	{
+		pointer	node = lower_bound(key, cmp);
+
+		if (node && !cmp(key, node->elem.first))
+			return node;
+		return NULL;
 	}
 };
 
@@ -3,150 +3,154 @@
 
 namespace ft{
 
-template <class bst_pointer>
-bst_pointer	destroy_no_child(bst_pointer &d_ptr)
+template <class bst_pointer, class Alloc>
+void	destroy_pointer( bst_pointer & tmp, Alloc & fct)
 {
-	destroy_pointer(d_ptr, d_ptr->allocker);
-	return NULL;
+	if (tmp != NULL)
+	{
+		fct.destroy(tmp);
+		fct.deallocate(tmp, 1);
+		tmp = NULL;
+	}
 }
 
-template <class bst_pointer>
-bst_pointer	destroy_mono_child( bst_pointer &d_ptr )
+//teardown of a whole subtree without recursion or stack: a left child is
+//rotated up until the current node has none, then the node is freed and
+//we go on with its right subtree. Each node is rotated at most once.
+template <class bst_pointer, class Alloc>
+void	destroy_tree( bst_pointer node, Alloc & fct )
 {
-	bst_pointer save_me;
-	if (d_ptr->left)
-		save_me = d_ptr->left;
-	else
-		save_me = d_ptr->right;
-	d_ptr->left = NULL;
-	d_ptr->right = NULL;
-	destroy_no_child(d_ptr);
-	return save_me;
+	while (node)
+	{
+		if (node->left)
+		{
+			bst_pointer new_top = node->left;
+
+			node->left = new_top->right;
+			new_top->right = node;
+			node = new_top;
+		}
+		else
+		{
+			bst_pointer next = node->right;
+
+			destroy_pointer(node, fct);
+			node = next;
+		}
+	}
 }
 
-template <class bst_pointer>
-bst_pointer	destroy_two_child( bst_pointer root )
+//copies elem, height and weight, links are left to the caller
+template <class bst_pointer, class Alloc>
+bst_pointer	clone_node( bst_pointer src, bst_pointer parent, Alloc & fct )
 {
-	struct ptr_cpy{
-		bst_pointer parent;
-		bst_pointer	left;
-		bst_pointer right;
+	bst_pointer node = fct.allocate(1);
 
-		ptr_cpy( bst_pointer ptr ) : parent(ptr->parent), left(ptr->left), right(ptr->right) {};
-	};
+	fct.construct(node, *src);
+	node->parent = parent;
+	return node;
+}
 
-	static bool flag = false;
-	bst_pointer	node;
-	if (flag)
-	{
-		flag = false;
-		node = root->right;
-		while (node->left)
-			node = node->left;
-	}
-	else
-	{
-		flag = true;
-		node = root->left;
-		while (node->right)
-			node = node->right;
-	}
+//deep copy of a whole subtree without recursion: both trees are walked in
+//pre-order side by side, a missing child on the copy means not visited yet
+template <class bst_pointer, class Alloc>
+bst_pointer	copy_tree( bst_pointer src, bst_pointer parent, Alloc & fct )
+{
+	if (!src)
+		return NULL;
 
-	if (root->left == node)
-	{
-		bst_pointer new_left = node->left;
-		bst_pointer new_right = root->right;
-		root->right = NULL;
-		root->left = NULL;
-		node->left = root;
-		node->right = new_right;
-		root->left = new_left;
-		node->parent = root->parent;
-		root->parent = node;
-	}
-	else if (root->right == node)
-	{
-		bst_pointer new_right = node->right;
-		bst_pointer new_left = root->left;
-		root->left = NULL;
-		root->right = NULL;
-		node->right = root;
-		node->left = new_left;
-		root->right = new_right;
-		node->parent = root->parent;
-		root->parent = node;
-	}
-	else
+	bst_pointer	src_root = src;
+	bst_pointer	node = clone_node(src, parent, fct);
+	bst_pointer	copy_root = node;
+
+	while (true)
 	{
-		bool left;
-		if (node->parent->left && node->parent->left == node)
+		if (src->left && !node->left)
 		{
-			node->parent->left = NULL;
-			left = true;
+			node->left = clone_node(src->left, node, fct);
+			src = src->left;
+			node = node->left;
 		}
-		if (node->parent->right && node->parent->right == node)
+		else if (src->right && !node->right)
 		{
-			node->parent->right = NULL;
-			left = false;
+			node->right = clone_node(src->right, node, fct);
+			src = src->right;
+			node = node->right;
 		}
-
-		ptr_cpy root_cpy(root);
-		ptr_cpy node_cpy(node);
-		node->left = root_cpy.left;
-		node->right = root_cpy.right;
-		node->parent = root_cpy.parent;
-		root->left = node_cpy.left;
-		root->right = node_cpy.right;
-		root->parent = node_cpy.parent;
-		if (left)
-			node_cpy.parent->left = root;
+		else if (src == src_root)
+			return copy_root;
 		else
-			node_cpy.parent->right = root;
+		{
+			src = src->parent;
+			node = node->parent;
+		}
 	}
+}
 
-	bst_pointer root_parent = root->parent;
+//the successor takes the place (height and weight) of the erased node,
+//nodes are relinked and never copied so iterators on them stay valid
+template <class bst_pointer>
+bst_pointer	unlink_two_child( bst_pointer d_stroy, bst_pointer header )
+{
+	bst_pointer	node = d_stroy->right;
+	bst_pointer	rebalance_from;
 
-	if (root_parent->left == root)
-		root_parent->left = destroy(root);
+	while (node->left)
+		node = node->left;
+	if (node->parent == d_stroy)
+		rebalance_from = node;
 	else
-		root_parent->right = destroy(root);	
-	
-	node->recursive_balancing();
-
-	if (node != root_parent)
 	{
-		bst_pointer saved_parent = root_parent->parent;
-		if (saved_parent->left == root_parent)
-			saved_parent->left = rotate(root_parent);
-		else
-			saved_parent->right = rotate(root_parent);
+		rebalance_from = node->parent;
+		node->parent->left = node->right;
+		if (node->right)
+			node->right->parent = node->parent;
+		node->right = d_stroy->right;
+		node->right->parent = node;
 	}
-	return node;
+	node->left = d_stroy->left;
+	node->left->parent = node;
+	replace_child(d_stroy->parent, d_stroy, node, header);
+	node->parent = d_stroy->parent;
+	node->height = d_stroy->height;
+	node->weight = d_stroy->weight;
+	return rebalance_from;
 }
 
 template <class bst_pointer>
-bst_pointer	destroy( bst_pointer &d_stroy )
+bst_pointer	unlink_mono_child( bst_pointer d_stroy, bst_pointer header )
 {
-	bst_pointer new_node;
-	
-	if (!d_stroy->left && !d_stroy->right)
-		new_node = destroy_no_child(d_stroy);
-	else if ((!d_stroy->left && d_stroy->right) || (d_stroy->left && !d_stroy->right))
-		new_node = destroy_mono_child(d_stroy);
+	bst_pointer save_me;
+
+	if (d_stroy->left)
+		save_me = d_stroy->left;
 	else
-		new_node = destroy_two_child(d_stroy);
-	return new_node;
+		save_me = d_stroy->right;
+	replace_child(d_stroy->parent, d_stroy, save_me, header);
+	if (save_me)
+		save_me->parent = d_stroy->parent;
+	return d_stroy->parent;
 }
 
+//leftmost and rightmost have at most one child, the new extreme is
+//found from there before the node is unlinked
 template <class bst_pointer, class Alloc>
-void	destroy_pointer( bst_pointer & tmp, Alloc fct)
+void	destroy( bst_pointer d_stroy, bst_pointer header, Alloc & fct )
 {
-	if (tmp != NULL)
-	{
-		fct.destroy(tmp);
-		fct.deallocate(tmp, 1);
-		tmp = NULL;
-	}
+	bst_pointer rebalance_from;
+
+	if (header->left == d_stroy)
+		header->left = (d_stroy->right ? d_stroy->right->find_start() : d_stroy->parent);
+	if (header->right == d_stroy)
+		header->right = (d_stroy->left ? d_stroy->left->find_end() : d_stroy->parent);
+	if (d_stroy->left && d_stroy->right)
+		rebalance_from = unlink_two_child(d_stroy, header);
+	else
+		rebalance_from = unlink_mono_child(d_stroy, header);
+	d_stroy->left = NULL;
+	d_stroy->right = NULL;
+	destroy_pointer(d_stroy, fct);
+	rebalance_up(rebalance_from, header);
 }
 
 }
@@ -3,12 +3,47 @@
 
 namespace ft{
 
+template <class bst_pointer>
+int	max_depth_under( bst_pointer side ) {
+	if (!side)
+		return 0;
+	else
+		return (side->height);
+}
+
+template <class bst_pointer>
+std::size_t	subtree_weight( bst_pointer side ) {
+	if (!side)
+		return 0;
+	return (side->weight);
+}
+
+template <class bst_pointer>
+int	balance_factor( bst_pointer elem ) {
+	return (max_depth_under(elem->left) - max_depth_under(elem->right));
+}
+
+template <class bst_pointer>
+void	balance(bst_pointer elem)
+{
+	if (!elem)
+		return ;
+	elem->height = std::max<int>(max_depth_under(elem->left), max_depth_under(elem->right)) + 1;
+	elem->weight = subtree_weight(elem->left) + subtree_weight(elem->right) + 1;
+}
+
+//only node and new_start change height and weight, their children are untouched
 template <class bst_pointer>
 bst_pointer	right_right( bst_pointer node ){
 	bst_pointer new_start = node->left;
 	node->left = new_start->right;
+	if (node->left)
+		node->left->parent = node;
 	new_start->right = node;
-	new_start->recursive_balancing();
+	new_start->parent = node->parent;
+	node->parent = new_start;
+	balance(node);
+	balance(new_start);
 	return new_start;
 }
 
@@ -17,8 +52,13 @@ bst_pointer left_left( bst_pointer node)
 {
 	bst_pointer new_start = node->right;
 	node->right = new_start->left;
+	if (node->right)
+		node->right->parent = node;
 	new_start->left = node;
-	new_start->recursive_balancing();
+	new_start->parent = node->parent;
+	node->parent = new_start;
+	balance(node);
+	balance(new_start);
 	return new_start;
 }
 
@@ -36,25 +76,6 @@ bst_pointer right_left( bst_pointer node )
 	return (left_left(node));
 }
 
-template <class bst_pointer>
-int	max_depth_under( bst_pointer side ) {
-	if (!side)
-		return 0;
-	else{
-		return (std::max<int>(side->depth.left, side->depth.right) + 1);
-	}
-}
-
-template <class bst_pointer>
-void	balance(bst_pointer elem)
-{
-	if (!elem)
-		return ;
-	elem->depth.left =  max_depth_under(elem->left);
-	elem->depth.right =  max_depth_under(elem->right);
-	elem->depth.balance = elem->depth.left - elem->depth.right;
-}
-
 template <class bst_pointer>
 bst_pointer	rotate( bst_pointer node )
 {
@@ -62,27 +83,156 @@ bst_pointer	rotate( bst_pointer node )
 
 	if (!node)
 		return NULL;
-	if (node->depth.balance < -1 || node->depth.balance > 1)
+	int factor = balance_factor(node);
+	if (factor < -1 || factor > 1)
 	{
-		if (node->depth.balance > 0)
+		if (factor > 0)
 		{
-			if (node->left->depth.right == std::max(node->left->depth.left, node->left->depth.right))
+			if (balance_factor(node->left) < 0)
 				new_node = left_right(node);
 			else
 				new_node = right_right(node);
 		}
 		else
 		{
-			if (node->right->depth.left == std::max(node->right->depth.left, node->right->depth.right))
+			if (balance_factor(node->right) > 0)
 				new_node = right_left(node);
 			else
 				new_node = left_left(node);
 		}
-		balance(node);
 	}
 	return new_node;
 }
 
+//the root's parent is the map header, whose own parent is the root
+template <class bst_pointer>
+void	replace_child( bst_pointer parent, bst_pointer old_child, bst_pointer new_child, bst_pointer header )
+{
+	if (parent == header)
+		header->parent = new_child;
+	else if (parent->left == old_child)
+		parent->left = new_child;
+	else
+		parent->right = new_child;
+}
+
+//in-order neighbours as pure pointer walks, no key comparison involved.
+//successor of the rightmost node is the header, the predecessor of the
+//header is the rightmost node (header->right), as in libstdc++
+template <class bst_pointer>
+bst_pointer	successor( bst_pointer node )
+{
+	if (node->right)
+	{
+		node = node->right;
+		while (node->left)
+			node = node->left;
+		return node;
+	}
+
+	bst_pointer	parent = node->parent;
+
+	while (node == parent->right)
+	{
+		node = parent;
+		parent = parent->parent;
+	}
+	if (node->right != parent)
+		node = parent;
+	return node;
+}
+
+template <class bst_pointer>
+bst_pointer	predecessor( bst_pointer node )
+{
+	if (node->height == 0)
+		return node->right;
+	if (node->left)
+	{
+		node = node->left;
+		while (node->right)
+			node = node->right;
+		return node;
+	}
+
+	bst_pointer	parent = node->parent;
+
+	while (node == parent->left)
+	{
+		node = parent;
+		parent = parent->parent;
+	}
+	return parent;
+}
+
+//walk up from node after an insert or an erase below it. Rotations stop
+//as soon as a subtree keeps the height it had before, the weights above
+//it only move by the change in that subtree's weight (unsigned wrap-around
+//makes it a decrement after an erase)
+template <class bst_pointer>
+void	rebalance_up( bst_pointer node, bst_pointer header )
+{
+	std::size_t	delta = 0;
+
+	while (node != header)
+	{
+		int			old_height = max_depth_under(node);
+		std::size_t	old_weight = node->weight;
+		bst_pointer	parent = node->parent;
+		bst_pointer	new_node;
+
+		balance(node);
+		new_node = rotate(node);
+		if (new_node != node)
+			replace_child(parent, node, new_node, header);
+		node = parent;
+		if (max_depth_under(new_node) == old_height)
+		{
+			delta = new_node->weight - old_weight;
+			break ;
+		}
+	}
+	for (; node != header; node = node->parent)
+		node->weight += delta;
+}
+
+//k-th node in key order (from 0) of the subtree, NULL past its end
+template <class bst_pointer>
+bst_pointer	select_node( bst_pointer node, std::size_t k )
+{
+	while (node)
+	{
+		std::size_t	left = subtree_weight(node->left);
+
+		if (k < left)
+			node = node->left;
+		else if (k == left)
+			return node;
+		else
+		{
+			k -= left + 1;
+			node = node->right;
+		}
+	}
+	return NULL;
+}
+
+//number of nodes before node in key order, climbing to the header
+//(the only node of height 0)
+template <class bst_pointer>
+std::size_t	node_rank( bst_pointer node )
+{
+	std::size_t	rank = subtree_weight(node->left);
+
+	while (node->parent->height != 0)
+	{
+		if (node == node->parent->right)
+			rank += subtree_weight(node->parent->left) + 1;
+		node = node->parent;
+	}
+	return rank;
+}
+
 }
 
 #endif
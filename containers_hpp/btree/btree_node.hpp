@@ -0,0 +1,89 @@
+#ifndef __BTREE_NODE_HPP__
+# define __BTREE_NODE_HPP__
+
+# include <cstddef>
+# include <new>
+# include "../utils/traits.hpp"
+
+namespace ft{
+
+//leaves are chained in key order, the chain closes on a header owned by the
+//map: header.next is the first leaf, header.prev the last one
+struct btree_links
+{
+	btree_links	*prev;
+	btree_links	*next;
+};
+
+//about 512 bytes (8 cache lines) of keys or values per node, at least 4
+template < class Key, class Value >
+struct btree_sizes
+{
+	static const std::size_t	node_bytes = 512;
+	static const std::size_t	leaf_slots = node_bytes / sizeof(Value) < 4 ? 4 : node_bytes / sizeof(Value);
+	static const std::size_t	inner_keys = node_bytes / (sizeof(Key) + sizeof(void *)) < 4 ? 4 : node_bytes / (sizeof(Key) + sizeof(void *));
+};
+
+template < class Key, class Value >
+const std::size_t	btree_sizes<Key, Value>::leaf_slots;
+
+template < class Key, class Value >
+const std::size_t	btree_sizes<Key, Value>::inner_keys;
+
+//raw bytes for N objects, the other members only force the alignment
+#if __cplusplus >= 201103L
+template < class T, std::size_t N >
+struct btree_storage
+{
+	alignas(T) char	bytes[N * sizeof(T)];
+
+	T *			data( void ) { return (reinterpret_cast<T *>(bytes)); }
+	const T *	data( void ) const { return (reinterpret_cast<const T *>(bytes)); }
+};
+#else
+template < class T, std::size_t N >
+union btree_storage
+{
+	char		bytes[N * sizeof(T)];
+	long double	align_ld;
+	long		align_l;
+	void		*align_ptr;
+
+	T *			data( void ) { return (reinterpret_cast<T *>(bytes)); }
+	const T *	data( void ) const { return (reinterpret_cast<const T *>(bytes)); }
+};
+#endif
+
+//count is the number of values of a leaf, or of keys of an inner node,
+//which then has count + 1 children
+template < class Key, class Value >
+struct btree_node
+{
+	btree_node		*parent;
+	std::size_t		count;
+	bool			leaf;
+};
+
+template < class Key, class Value >
+struct btree_leaf : public btree_node<Key, Value>, public btree_links
+{
+	btree_storage< Value, btree_sizes<Key, Value>::leaf_slots >	values;
+
+	Value *			slots( void ) { return (values.data()); }
+	const Value *	slots( void ) const { return (values.data()); }
+};
+
+//all keys of children[i] are < keys[i] <= all keys of children[i + 1]
+template < class Key, class Value >
+struct btree_inner : public btree_node<Key, Value>
+{
+	btree_storage< Key, btree_sizes<Key, Value>::inner_keys >		key_storage;
+	btree_node<Key, Value>											*children[btree_sizes<Key, Value>::inner_keys + 1];
+
+	Key *			keys( void ) { return (key_storage.data()); }
+	const Key *		keys( void ) const { return (key_storage.data()); }
+};
+
+}
+
+#endif
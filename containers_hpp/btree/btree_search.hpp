@@ -0,0 +1,165 @@
+#ifndef __BTREE_SEARCH_HPP__
+# define __BTREE_SEARCH_HPP__
+
+# include <cstddef>
+# include "../utils/traits.hpp"
+# include "../utils/utils.hpp"
+# include "../utils/compare.hpp"
+
+namespace ft{
+
+//searches inside one node. Inner nodes look for the first key greater than
+//k, the child to descend into. Keys are contiguous, so arithmetic keys under
+//ft::less are scanned in order 4 or 2 at a time with SSE2 (a node is a few
+//cache lines, the scan stops at the first greater key). Other keys go
+//through a binary search whose loop only depends on n
+
+template <class Key, class Compare>
+struct btree_linear_search : public false_type {};
+
+template <class Key>
+struct btree_linear_search< Key, ft::less<Key> > : public integral_constant<bool, ft::is_integral<Key>::value || ft::is_floating_point<Key>::value> {};
+
+//scalar scan, also the tail of the SSE2 ones
+template <class Key>
+inline std::size_t	btree_upper_bound_linear( const Key * keys, std::size_t n, Key k, std::size_t i = 0 )
+{
+	while (i != n && !(k < keys[i]))
+		i++;
+	return (i);
+}
+
+#if FT_COMPARE_X86
+inline std::size_t	btree_upper_bound_linear( const int * keys, std::size_t n, int k )
+{
+	__m128i		kv = _mm_set1_epi32(k);
+	std::size_t	i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		int	greater = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), kv)));
+
+		if (greater)
+			return (i + __builtin_ctz(greater));
+	}
+	return (btree_upper_bound_linear(keys, n, k, i));
+}
+
+//SSE2 only compares signed lanes, flipping the top bit keeps the order
+inline std::size_t	btree_upper_bound_linear( const unsigned int * keys, std::size_t n, unsigned int k )
+{
+	__m128i		bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+	__m128i		kv = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(k)), bias);
+	std::size_t	i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128i	x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), bias);
+		int		greater = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, kv)));
+
+		if (greater)
+			return (i + __builtin_ctz(greater));
+	}
+	return (btree_upper_bound_linear(keys, n, k, i));
+}
+
+inline std::size_t	btree_upper_bound_linear( const float * keys, std::size_t n, float k )
+{
+	__m128		kv = _mm_set1_ps(k);
+	std::size_t	i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		int	greater = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(keys + i), kv));
+
+		if (greater)
+			return (i + __builtin_ctz(greater));
+	}
+	return (btree_upper_bound_linear(keys, n, k, i));
+}
+
+inline std::size_t	btree_upper_bound_linear( const double * keys, std::size_t n, double k )
+{
+	__m128d		kv = _mm_set1_pd(k);
+	std::size_t	i = 0;
+
+	for (; i + 2 <= n; i += 2)
+	{
+		int	greater = _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(keys + i), kv));
+
+		if (greater)
+			return (i + __builtin_ctz(greater));
+	}
+	return (btree_upper_bound_linear(keys, n, k, i));
+}
+#endif
+
+template <class Key, class Compare>
+std::size_t	btree_upper_bound( const Key * keys, std::size_t n, const Key & k, const Compare &, ft::true_type )
+{
+	return (btree_upper_bound_linear(keys, n, k));
+}
+
+template <class Key, class Compare>
+std::size_t	btree_upper_bound( const Key * keys, std::size_t n, const Key & k, const Compare & comp, ft::false_type )
+{
+	const Key	*base = keys;
+
+	if (n == 0)
+		return 0;
+	while (n > 1)
+	{
+		std::size_t	half = n / 2;
+
+		base = comp(k, base[half]) ? base : base + half;
+		n -= half;
+	}
+	return (base - keys + !comp(k, *base));
+}
+
+//index of the first of the n sorted keys greater than k
+template <class Key, class Compare>
+std::size_t	btree_upper_bound( const Key * keys, std::size_t n, const Key & k, const Compare & comp )
+{
+	return (btree_upper_bound(keys, n, k, comp, ft::integral_constant<bool, btree_linear_search<Key, Compare>::value>()));
+}
+
+//index of the first of the n pairs sorted by key whose key is not less
+//than k (or, upper, greater than k). Leaves hold pairs, not bare keys
+template <class Value, class Key, class Compare>
+std::size_t	btree_lower_bound_values( const Value * values, std::size_t n, const Key & k, const Compare & comp )
+{
+	const Value	*base = values;
+
+	if (n == 0)
+		return 0;
+	while (n > 1)
+	{
+		std::size_t	half = n / 2;
+
+		base = comp(base[half].first, k) ? base + half : base;
+		n -= half;
+	}
+	return (base - values + comp(base->first, k));
+}
+
+template <class Value, class Key, class Compare>
+std::size_t	btree_upper_bound_values( const Value * values, std::size_t n, const Key & k, const Compare & comp )
+{
+	const Value	*base = values;
+
+	if (n == 0)
+		return 0;
+	while (n > 1)
+	{
+		std::size_t	half = n / 2;
+
+		base = comp(k, base[half].first) ? base : base + half;
+		n -= half;
+	}
+	return (base - values + !comp(k, base->first));
+}
+
+}
+
+#endif
@@ -0,0 +1,878 @@
+#ifndef __BTREE_MAP_HPP__
+# define __BTREE_MAP_HPP__
+
+# include "containers.hpp"
+# include "utils/utils.hpp"
+# include "utils/relocate.hpp"
+# include "btree/btree_node.hpp"
+# include "btree/btree_search.hpp"
+# include "iterators/btree_iterator.hpp"
+# include "vector.hpp"
+
+namespace ft{
+
+//ft::map's interface over a B+-tree. Values only live in the leaves, up to
+//512 bytes of them per leaf, and inner nodes hold contiguous separator keys
+//with their children: a lookup is a handful of node visits instead of one
+//miss per level of an AVL tree. Leaves are chained, so iterating never
+//climbs back to a parent.
+//Values move between leaves when nodes split or merge: any insert or erase
+//invalidates iterators, as for ft::flat_map
+template < class Key,
+			class T,
+			class Compare = ft::less< Key >,
+			class Alloc = std::allocator< ft::pair<const Key,T> >
+			>
+class btree_map
+{
+	public:
+		typedef Key																		key_type;
+		typedef T																		mapped_type;
+		typedef ft::pair< const Key, T >												value_type;
+		typedef Compare																	key_compare;
+		typedef Alloc																	allocator_type;
+		typedef typename allocator_type::size_type										size_type;
+		typedef typename allocator_type::reference										reference;
+		typedef typename allocator_type::const_reference								const_reference;
+		typedef typename allocator_type::pointer										pointer;
+		typedef typename allocator_type::const_pointer									const_pointer;
+		typedef typename allocator_type::difference_type								difference_type;
+		typedef ft::btree_node< Key, value_type >										node_type;
+		typedef ft::btree_leaf< Key, value_type >										leaf_type;
+		typedef ft::btree_inner< Key, value_type >										inner_type;
+		typedef ft::btree_iterator< leaf_type, value_type, false >						iterator;
+		typedef ft::btree_iterator< leaf_type, value_type, true >						const_iterator;
+		typedef typename ft::reverse_iterator<iterator>									reverse_iterator;
+		typedef typename ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+		class value_compare
+		{
+			friend class btree_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				typedef bool result_type;
+				typedef value_type first_argument_type;
+				typedef value_type second_argument_type;
+				bool operator() (const value_type& x, const value_type& y) const
+				{
+					return comp(x.first, y.first);
+				}
+		};
+
+	private:
+		typedef ft::btree_sizes< Key, value_type >										sizes;
+		typedef typename Alloc::template rebind< Key >::other							key_allocator_type;
+		typedef typename Alloc::template rebind< leaf_type >::other						leaf_allocator_type;
+		typedef typename Alloc::template rebind< inner_type >::other					inner_allocator_type;
+
+		key_compare				_compare;
+		allocator_type			_allocker;
+		key_allocator_type		_key_allocker;
+		leaf_allocator_type		_leaf_allocker;
+		inner_allocator_type	_inner_allocker;
+		node_type				*_root;
+		btree_links				_header;
+		size_type				_size;
+
+	public:
+		explicit btree_map (const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _compare(comp), _allocker(alloc), _key_allocker(alloc),
+				_leaf_allocker(alloc), _inner_allocker(alloc), _root(NULL), _size(0) { reset_header(); }
+
+		btree_map (const btree_map& x) : _compare(x._compare), _allocker(x._allocker), _key_allocker(x._allocker),
+				_leaf_allocker(x._allocker), _inner_allocker(x._allocker), _root(NULL), _size(0) {
+			reset_header();
+			if (x._size)
+				bulk_load(x.begin(), x._size);
+		}
+
+		template <class InputIterator>
+		btree_map (InputIterator first, InputIterator last,
+		const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _compare(comp), _allocker(alloc), _key_allocker(alloc),
+				_leaf_allocker(alloc), _inner_allocker(alloc), _root(NULL), _size(0) {
+			reset_header();
+			insert(first, last);
+		}
+
+#if __cplusplus >= 201103L
+		btree_map (btree_map&& x) : _compare(x._compare), _allocker(x._allocker), _key_allocker(x._allocker),
+				_leaf_allocker(x._allocker), _inner_allocker(x._allocker), _root(NULL), _size(0) {
+			reset_header();
+			swap(x);
+		}
+#endif
+
+		~btree_map( void ) { clear(); }
+
+		btree_map&	operator=(const btree_map& x) {
+			if (this != &x)
+			{
+				clear();
+				_compare = x._compare;
+				if (x._size)
+					bulk_load(x.begin(), x._size);
+			}
+			return (*this);
+		}
+
+#if __cplusplus >= 201103L
+		btree_map&	operator=(btree_map&& x) {
+			if (this != &x)
+			{
+				btree_map tmp(std::move(x));
+
+				swap(tmp);
+			}
+			return (*this);
+		}
+#endif
+
+	//NODES//
+	private:
+		void	reset_header( void )
+		{
+			_header.prev = &_header;
+			_header.next = &_header;
+		}
+
+		static void	link_after( btree_links * pos, btree_links * node )
+		{
+			node->prev = pos;
+			node->next = pos->next;
+			pos->next->prev = node;
+			pos->next = node;
+		}
+
+		static void	unlink( btree_links * node )
+		{
+			node->prev->next = node->next;
+			node->next->prev = node->prev;
+		}
+
+		//the storage is left raw, slots and keys are built one by one
+		leaf_type *	new_leaf( void )
+		{
+			leaf_type	*leaf = new (static_cast<void *>(_leaf_allocker.allocate(1))) leaf_type;
+
+			leaf->parent = NULL;
+			leaf->count = 0;
+			leaf->leaf = true;
+			return (leaf);
+		}
+
+		inner_type *	new_inner( void )
+		{
+			inner_type	*inner = new (static_cast<void *>(_inner_allocker.allocate(1))) inner_type;
+
+			inner->parent = NULL;
+			inner->count = 0;
+			inner->leaf = false;
+			return (inner);
+		}
+
+		void	destroy_node( node_type * node )
+		{
+			if (node->leaf)
+			{
+				leaf_type	*leaf = static_cast<leaf_type *>(node);
+
+				for (size_type i = 0; i != leaf->count; i++)
+					_allocker.destroy(leaf->slots() + i);
+				_leaf_allocker.deallocate(leaf, 1);
+				return ;
+			}
+
+			inner_type	*inner = static_cast<inner_type *>(node);
+
+			for (size_type i = 0; i != inner->count; i++)
+				_key_allocker.destroy(inner->keys() + i);
+			for (size_type i = 0; i != inner->count + 1; i++)
+				destroy_node(inner->children[i]);
+			_inner_allocker.deallocate(inner, 1);
+		}
+
+		static size_type	child_index( inner_type * parent, node_type * child )
+		{
+			size_type	i = 0;
+
+			while (parent->children[i] != child)
+				i++;
+			return (i);
+		}
+
+	//SEARCH//
+	private:
+		leaf_type *	find_leaf( const key_type& k ) const
+		{
+			node_type	*node = _root;
+
+			while (!node->leaf)
+			{
+				inner_type	*inner = static_cast<inner_type *>(node);
+
+				node = inner->children[btree_upper_bound(inner->keys(), inner->count, k, _compare)];
+			}
+			return (static_cast<leaf_type *>(node));
+		}
+
+		//leaf and slot where k is, or would go. An empty tree gets its
+		//first leaf
+		bool	find_slot( const key_type& k, leaf_type *& leaf, size_type & i )
+		{
+			if (!_root)
+			{
+				leaf = new_leaf();
+				link_after(&_header, leaf);
+				_root = leaf;
+				i = 0;
+				return false;
+			}
+			leaf = find_leaf(k);
+			i = btree_lower_bound_values(leaf->slots(), leaf->count, k, _compare);
+			return (i != leaf->count && !_compare(k, leaf->slots()[i].first));
+		}
+
+		//the slot past the last one of a leaf is the first of the next leaf
+		iterator	make_iterator( btree_links * node, size_type i ) const
+		{
+			if (node != &_header && i == static_cast<leaf_type *>(node)->count)
+				return (iterator(node->next, 0));
+			return (iterator(node, i));
+		}
+
+		btree_links *	header( void ) const { return (const_cast<btree_links *>(&_header)); }
+
+		static iterator	unconst( const_iterator it ) { return (iterator(it.node(), it.index())); }
+
+	//INSERTION//
+	private:
+		//makes room at slot i of leaf, splitting it first when it is full.
+		//leaf and i are moved to where the new value goes, the caller builds
+		//it there then counts it. Appending to the last leaf (or prepending
+		//to the first one) splits unevenly, so sorted loads fill their leaves
+		value_type *	open_slot( leaf_type *& leaf, size_type & i )
+		{
+			if (leaf->count == sizes::leaf_slots)
+			{
+				size_type	mid = leaf->count / 2;
+				leaf_type	*right = new_leaf();
+
+				if (i == leaf->count && leaf->next == &_header)
+					mid = leaf->count - 1;
+				else if (i == 0 && leaf->prev == &_header)
+					mid = 1;
+				ft::relocate(_allocker, right->slots(), leaf->slots() + mid, leaf->count - mid);
+				right->count = leaf->count - mid;
+				leaf->count = mid;
+				link_after(leaf, right);
+				insert_in_parent(leaf, right->slots()[0].first, right);
+				if (i > mid)
+				{
+					i -= mid;
+					leaf = right;
+				}
+			}
+			ft::relocate(_allocker, leaf->slots() + i + 1, leaf->slots() + i, leaf->count - i);
+			return (leaf->slots() + i);
+		}
+
+		//key and child go right after slot pos of inner, which has room
+		void	insert_in_inner( inner_type * inner, size_type pos, const key_type& key, node_type * child )
+		{
+			ft::relocate(_key_allocker, inner->keys() + pos + 1, inner->keys() + pos, inner->count - pos);
+			_key_allocker.construct(inner->keys() + pos, key);
+			std::memmove(inner->children + pos + 2, inner->children + pos + 1, (inner->count - pos) * sizeof(node_type *));
+			inner->children[pos + 1] = child;
+			child->parent = inner;
+			inner->count++;
+		}
+
+		//right was split off left, key is its smallest one. A full parent
+		//is split in turn, its middle key going one level up
+		void	insert_in_parent( node_type * left, const key_type& key, node_type * right )
+		{
+			inner_type	*parent = static_cast<inner_type *>(left->parent);
+
+			if (!parent)
+			{
+				inner_type	*root = new_inner();
+
+				_key_allocker.construct(root->keys(), key);
+				root->children[0] = left;
+				root->children[1] = right;
+				root->count = 1;
+				left->parent = root;
+				right->parent = root;
+				_root = root;
+				return ;
+			}
+
+			size_type	pos = child_index(parent, left);
+
+			if (parent->count < sizes::inner_keys)
+			{
+				insert_in_inner(parent, pos, key, right);
+				return ;
+			}
+
+			size_type	mid = parent->count / 2;
+			inner_type	*sibling = new_inner();
+			key_type	up(parent->keys()[mid]);
+
+			ft::relocate(_key_allocker, sibling->keys(), parent->keys() + mid + 1, parent->count - mid - 1);
+			std::memcpy(sibling->children, parent->children + mid + 1, (parent->count - mid) * sizeof(node_type *));
+			sibling->count = parent->count - mid - 1;
+			for (size_type i = 0; i != sibling->count + 1; i++)
+				sibling->children[i]->parent = sibling;
+			_key_allocker.destroy(parent->keys() + mid);
+			parent->count = mid;
+			if (pos <= mid)
+				insert_in_inner(parent, pos, key, right);
+			else
+				insert_in_inner(sibling, pos - mid - 1, key, right);
+			insert_in_parent(parent, up, sibling);
+		}
+
+#if __cplusplus >= 201103L
+		template <class... Args>
+		iterator	insert_new( leaf_type * leaf, size_type i, Args&&... args )
+		{
+			value_type	*slot = open_slot(leaf, i);
+
+			std::allocator_traits<allocator_type>::construct(_allocker, slot, std::forward<Args>(args)...);
+			leaf->count++;
+			_size++;
+			return (iterator(leaf, i));
+		}
+#else
+		iterator	insert_new( leaf_type * leaf, size_type i, const value_type& val )
+		{
+			value_type	*slot = open_slot(leaf, i);
+
+			_allocker.construct(slot, val);
+			leaf->count++;
+			_size++;
+			return (iterator(leaf, i));
+		}
+#endif
+
+		//sorted unique input: leaves are filled evenly from left to right,
+		//then each level of inner nodes is built over the one below
+		template <class ForwardIterator>
+		void	bulk_load( ForwardIterator first, size_type n )
+		{
+			size_type					leaves = (n + sizes::leaf_slots - 1) / sizes::leaf_slots;
+			ft::vector<node_type *>		level;
+			ft::vector<const key_type *>	mins;
+
+			level.reserve(leaves);
+			mins.reserve(leaves);
+			for (size_type l = 0; l != leaves; l++)
+			{
+				leaf_type	*leaf = new_leaf();
+				size_type	count = n / leaves + (l < n % leaves);
+
+				link_after(_header.prev, leaf);
+				for (; leaf->count != count; ++first)
+					_allocker.construct(leaf->slots() + leaf->count++, *first);
+				level.push_back(leaf);
+				mins.push_back(&leaf->slots()[0].first);
+			}
+			_size = n;
+			while (level.size() > 1)
+			{
+				size_type						groups = (level.size() + sizes::inner_keys) / (sizes::inner_keys + 1);
+				size_type						c = 0;
+				ft::vector<node_type *>			up;
+				ft::vector<const key_type *>	up_mins;
+
+				for (size_type g = 0; g != groups; g++)
+				{
+					inner_type	*inner = new_inner();
+					size_type	children = level.size() / groups + (g < level.size() % groups);
+
+					up_mins.push_back(mins[c]);
+					for (size_type j = 0; j != children; j++, c++)
+					{
+						if (j)
+							_key_allocker.construct(inner->keys() + j - 1, *mins[c]);
+						inner->children[j] = level[c];
+						level[c]->parent = inner;
+					}
+					inner->count = children - 1;
+					up.push_back(inner);
+				}
+				level.swap(up);
+				mins.swap(up_mins);
+			}
+			_root = level[0];
+		}
+
+	public:
+		ft::pair<iterator,bool> insert (const value_type& val){
+			leaf_type	*leaf;
+			size_type	i;
+
+			if (find_slot(val.first, leaf, i))
+				return (ft::make_pair(iterator(leaf, i), false));
+			return (ft::make_pair(insert_new(leaf, i, val), true));
+		}
+
+#if __cplusplus >= 201103L
+		//the key is looked up before anything is built or moved from
+		ft::pair<iterator,bool> insert (value_type&& val) {
+			leaf_type	*leaf;
+			size_type	i;
+
+			if (find_slot(val.first, leaf, i))
+				return (ft::make_pair(iterator(leaf, i), false));
+			return (ft::make_pair(insert_new(leaf, i, std::move(val)), true));
+		}
+
+		//the pair has to exist before its key can be compared
+		template <class... Args>
+		ft::pair<iterator,bool> emplace (Args&&... args) {
+			return (insert(value_type(std::forward<Args>(args)...)));
+		}
+
+		//args are left untouched when k is already there
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (const key_type& k, Args&&... args) {
+			return (emplace_key(k, std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (key_type&& k, Args&&... args) {
+			return (emplace_key(std::move(k), std::forward<Args>(args)...));
+		}
+
+	private:
+		template <class K, class... Args>
+		ft::pair<iterator,bool>	emplace_key( K&& k, Args&&... args )
+		{
+			leaf_type	*leaf;
+			size_type	i;
+
+			if (find_slot(k, leaf, i))
+				return (ft::make_pair(iterator(leaf, i), false));
+			return (ft::make_pair(insert_new(leaf, i, std::forward<K>(k), mapped_type(std::forward<Args>(args)...)), true));
+		}
+
+	public:
+#endif
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last){
+			iterator hint = end();
+
+			if (!_root && build_sorted(first, last, typename std::iterator_traits<InputIterator>::iterator_category()))
+				return ;
+			for (; first != last; first++)
+				hint = insert(hint, *first);
+		}
+
+		//same contract as ft::map: val goes right before (or right after)
+		//position when it fits there, otherwise we fall back on a descent
+		iterator insert (iterator position, const value_type& val)
+		{
+			if (!_root)
+				return (insert(val).first);
+			if (position == end())
+			{
+				leaf_type	*last = static_cast<leaf_type *>(_header.prev);
+
+				if (_compare(last->slots()[last->count - 1].first, val.first))
+					return (insert_new(last, last->count, val));
+				return (insert(val).first);
+			}
+
+			leaf_type	*leaf = position.leaf();
+			size_type	i = position.index();
+
+			if (_compare(val.first, position->first))
+			{
+				if (i ? _compare(leaf->slots()[i - 1].first, val.first) : leaf->prev == &_header)
+					return (insert_new(leaf, i, val));
+			}
+			else if (_compare(position->first, val.first))
+			{
+				if (i + 1 != leaf->count ? _compare(val.first, leaf->slots()[i + 1].first) : leaf->next == &_header)
+					return (insert_new(leaf, i + 1, val));
+			}
+			else
+				return (position);
+			return (insert(val).first);
+		}
+
+	private:
+		template <class InputIterator>
+		bool	build_sorted( InputIterator, InputIterator, std::input_iterator_tag ) { return false; }
+
+		//sorted unique input skips the descents: one pass to check the
+		//order, one pass to lay the tree out
+		template <class ForwardIterator>
+		bool	build_sorted( ForwardIterator first, ForwardIterator last, std::forward_iterator_tag )
+		{
+			size_type		n = 0;
+			ForwardIterator	prev = first;
+
+			for (ForwardIterator it = first; it != last; it++, n++)
+			{
+				if (n && !_compare((*prev).first, (*it).first))
+					return false;
+				prev = it;
+			}
+			if (n)
+				bulk_load(first, n);
+			return true;
+		}
+
+	//ERASE//
+	private:
+		//inner loses keys[pos] and children[pos + 1]
+		void	remove_child( inner_type * inner, size_type pos )
+		{
+			_key_allocker.destroy(inner->keys() + pos);
+			ft::relocate(_key_allocker, inner->keys() + pos, inner->keys() + pos + 1, inner->count - pos - 1);
+			std::memmove(inner->children + pos + 1, inner->children + pos + 2, (inner->count - pos - 1) * sizeof(node_type *));
+			inner->count--;
+		}
+
+		//an inner node under half full merges with a sibling or takes one
+		//child from it. A root left with a single child hands it the root
+		void	fix_inner( inner_type * inner )
+		{
+			if (inner == _root)
+			{
+				if (inner->count == 0)
+				{
+					_root = inner->children[0];
+					_root->parent = NULL;
+					_inner_allocker.deallocate(inner, 1);
+				}
+				return ;
+			}
+			if (inner->count >= sizes::inner_keys / 2)
+				return ;
+
+			inner_type	*parent = static_cast<inner_type *>(inner->parent);
+			size_type	pos = child_index(parent, inner);
+			size_type	left_pos = pos ? pos - 1 : 0;
+			inner_type	*left = static_cast<inner_type *>(parent->children[left_pos]);
+			inner_type	*right = static_cast<inner_type *>(parent->children[left_pos + 1]);
+			key_type	*separator = parent->keys() + left_pos;
+
+			if (left->count + right->count + 1 <= sizes::inner_keys)
+			{
+				_key_allocker.construct(left->keys() + left->count, *separator);
+				ft::relocate(_key_allocker, left->keys() + left->count + 1, right->keys(), right->count);
+				std::memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(node_type *));
+				for (size_type i = 0; i != right->count + 1; i++)
+					right->children[i]->parent = left;
+				left->count += right->count + 1;
+				_inner_allocker.deallocate(right, 1);
+				remove_child(parent, left_pos);
+				fix_inner(parent);
+			}
+			else if (left->count < right->count)
+			{
+				_key_allocker.construct(left->keys() + left->count, *separator);
+				left->children[left->count + 1] = right->children[0];
+				left->children[left->count + 1]->parent = left;
+				left->count++;
+				*separator = right->keys()[0];
+				_key_allocker.destroy(right->keys());
+				ft::relocate(_key_allocker, right->keys(), right->keys() + 1, right->count - 1);
+				std::memmove(right->children, right->children + 1, right->count * sizeof(node_type *));
+				right->count--;
+			}
+			else
+			{
+				ft::relocate(_key_allocker, right->keys() + 1, right->keys(), right->count);
+				_key_allocker.construct(right->keys(), *separator);
+				std::memmove(right->children + 1, right->children, (right->count + 1) * sizeof(node_type *));
+				right->children[0] = left->children[left->count];
+				right->children[0]->parent = right;
+				right->count++;
+				*separator = left->keys()[left->count - 1];
+				_key_allocker.destroy(left->keys() + left->count - 1);
+				left->count--;
+			}
+		}
+
+		//a leaf under half full merges with a sibling when both fit in one,
+		//otherwise the two share their values evenly
+		void	fix_leaf( leaf_type * leaf )
+		{
+			inner_type	*parent = static_cast<inner_type *>(leaf->parent);
+			size_type	pos = child_index(parent, leaf);
+			size_type	left_pos = pos ? pos - 1 : 0;
+			leaf_type	*left = static_cast<leaf_type *>(parent->children[left_pos]);
+			leaf_type	*right = static_cast<leaf_type *>(parent->children[left_pos + 1]);
+
+			if (left->count + right->count <= sizes::leaf_slots)
+			{
+				ft::relocate(_allocker, left->slots() + left->count, right->slots(), right->count);
+				left->count += right->count;
+				unlink(right);
+				_leaf_allocker.deallocate(right, 1);
+				remove_child(parent, left_pos);
+				fix_inner(parent);
+				return ;
+			}
+
+			size_type	half = (left->count + right->count) / 2;
+
+			if (left->count < half)
+			{
+				size_type	n = half - left->count;
+
+				ft::relocate(_allocker, left->slots() + left->count, right->slots(), n);
+				ft::relocate(_allocker, right->slots(), right->slots() + n, right->count - n);
+				left->count += n;
+				right->count -= n;
+			}
+			else
+			{
+				size_type	n = left->count - half;
+
+				ft::relocate(_allocker, right->slots() + n, right->slots(), right->count);
+				ft::relocate(_allocker, right->slots(), left->slots() + half, n);
+				left->count -= n;
+				right->count += n;
+			}
+			parent->keys()[left_pos] = right->slots()[0].first;
+		}
+
+		void	erase_at( leaf_type * leaf, size_type i )
+		{
+			_allocker.destroy(leaf->slots() + i);
+			ft::relocate(_allocker, leaf->slots() + i, leaf->slots() + i + 1, leaf->count - i - 1);
+			leaf->count--;
+			_size--;
+			if (leaf == _root)
+			{
+				if (leaf->count == 0)
+				{
+					unlink(leaf);
+					_leaf_allocker.deallocate(leaf, 1);
+					_root = NULL;
+				}
+			}
+			else if (leaf->count < sizes::leaf_slots / 2)
+				fix_leaf(leaf);
+		}
+
+	public:
+		void		erase( iterator position ) { erase_at(position.leaf(), position.index()); }
+
+		//values move when leaves merge: the range is walked again by key
+		void		erase(iterator first, iterator last)
+		{
+			size_type	n = 0;
+
+			for (iterator it = first; it != last; ++it)
+				n++;
+			if (n == _size)
+			{
+				clear();
+				return ;
+			}
+			while (n--)
+			{
+				key_type	k((*first).first);
+
+				erase(first);
+				first = lower_bound(k);
+			}
+		}
+
+		size_type	erase(const key_type & k)
+		{
+			if (!_root)
+				return 0;
+
+			leaf_type	*leaf = find_leaf(k);
+			size_type	i = btree_lower_bound_values(leaf->slots(), leaf->count, k, _compare);
+
+			if (i == leaf->count || _compare(k, leaf->slots()[i].first))
+				return 0;
+			erase_at(leaf, i);
+			return 1;
+		}
+
+	//ITERATORS//
+	public:
+		iterator		begin( void ) { return (make_iterator(_header.next, 0)); }
+		const_iterator	begin( void ) const { return (make_iterator(_header.next, 0)); }
+		iterator		end( void ) { return (iterator(&_header, 0)); }
+		const_iterator	end( void ) const { return (const_iterator(header(), 0)); }
+		reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+		reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+		const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+		const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+		iterator find (const key_type& k) { return (unconst(static_cast<const btree_map &>(*this).find(k))); }
+
+		const_iterator find (const key_type& k) const
+		{
+			if (!_root)
+				return (end());
+
+			leaf_type	*leaf = find_leaf(k);
+			size_type	i = btree_lower_bound_values(leaf->slots(), leaf->count, k, _compare);
+
+			if (i == leaf->count || _compare(k, leaf->slots()[i].first))
+				return (end());
+			return (const_iterator(leaf, i));
+		}
+
+		size_type	count( const key_type& k ) const { return (find(k) != end()); }
+
+		iterator		lower_bound (const key_type& k) { return (unconst(static_cast<const btree_map &>(*this).lower_bound(k))); }
+
+		const_iterator	lower_bound (const key_type& k) const
+		{
+			if (!_root)
+				return (end());
+
+			leaf_type	*leaf = find_leaf(k);
+
+			return (make_iterator(leaf, btree_lower_bound_values(leaf->slots(), leaf->count, k, _compare)));
+		}
+
+		iterator		upper_bound (const key_type& k) { return (unconst(static_cast<const btree_map &>(*this).upper_bound(k))); }
+
+		const_iterator	upper_bound (const key_type& k) const
+		{
+			if (!_root)
+				return (end());
+
+			leaf_type	*leaf = find_leaf(k);
+
+			return (make_iterator(leaf, btree_upper_bound_values(leaf->slots(), leaf->count, k, _compare)));
+		}
+
+		ft::pair<iterator,iterator>             equal_range (const key_type& k){
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+
+		ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const{
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+
+#if __cplusplus >= 201103L
+		mapped_type& operator[] (const key_type& k)
+		{
+			return (*(try_emplace(k).first)).second;
+		}
+
+		mapped_type& operator[] (key_type&& k)
+		{
+			return (*(try_emplace(std::move(k)).first)).second;
+		}
+#else
+		mapped_type& operator[] (const key_type& k)
+		{
+			leaf_type	*leaf;
+			size_type	i;
+
+			if (find_slot(k, leaf, i))
+				return (leaf->slots()[i].second);
+			return ((*insert_new(leaf, i, value_type(k, mapped_type()))).second);
+		}
+#endif
+
+	public:
+		void 			clear() {
+			if (_root)
+				destroy_node(_root);
+			_root = NULL;
+			_size = 0;
+			reset_header();
+		};
+		size_type		size( void ) const { return _size; }
+		size_type		max_size() const { return _allocker.max_size(); }
+		bool			empty( void ) const { return (_size == 0); }
+		allocator_type	get_allocator( void ) const { return _allocker; }
+		key_compare		key_comp() const { return _compare; }
+		value_compare 	value_comp() const { return value_compare(_compare); };
+
+		//the chain of leaves ends on the header of each map, it goes along
+		void			swap (btree_map& x) {
+			std::swap(_compare, x._compare);
+			std::swap(_allocker, x._allocker);
+			std::swap(_key_allocker, x._key_allocker);
+			std::swap(_leaf_allocker, x._leaf_allocker);
+			std::swap(_inner_allocker, x._inner_allocker);
+			std::swap(_root, x._root);
+			std::swap(_size, x._size);
+			std::swap(_header, x._header);
+			adopt_chain(x._header);
+			x.adopt_chain(_header);
+		};
+
+	private:
+		//the header was swapped with other's, chain ends still point there
+		void	adopt_chain( btree_links & other )
+		{
+			if (_header.next == &other)
+			{
+				reset_header();
+				return ;
+			}
+			_header.next->prev = &_header;
+			_header.prev->next = &_header;
+		}
+};
+
+template <class Key, class T, class Compare, class Alloc>
+void swap (btree_map<Key,T,Compare,Alloc>& x, btree_map<Key,T,Compare,Alloc>& y){
+	x.swap(y);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator== ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	if (lhs.size() != rhs.size())
+		return false;
+
+	typename btree_map<Key,T,Compare,Alloc>::const_iterator it2 = rhs.begin();
+
+	for (typename btree_map<Key,T,Compare,Alloc>::const_iterator it1 = lhs.begin(); it1 != lhs.end(); ++it1, ++it2)
+	{
+		if (*it1 != *it2)
+			return false;
+	}
+	return true;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator!= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(lhs == rhs));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<  ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(rhs < lhs));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>  ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	return (rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>= ( const btree_map<Key,T,Compare,Alloc>& lhs, const btree_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(lhs < rhs));
+}
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 # include <memory>
 # include <stdexcept>
 # include <algorithm>
+# include <iterator>
+# include <cstring>
 
 //DEBUG//
 # define RED "\033[38;5;124m"
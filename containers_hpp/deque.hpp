@@ -0,0 +1,475 @@
+#ifndef __DEQUE_HPP__
+# define __DEQUE_HPP__
+
+# include "containers.hpp"
+# include "iterators/iterator.hpp"
+# include "iterators/deque_iterator.hpp"
+# include "utils/traits.hpp"
+# include "utils/utils.hpp"
+
+namespace ft{
+
+//elements live in fixed-size blocks that never move, a map of block
+//pointers grows instead: push and pop at both ends are O(1) and keep
+//references to the other elements valid.
+//element i sits at position _start + i, in block (_start + i) / block_size
+template < typename T, typename A = std::allocator<T> >
+class deque{
+
+	public:
+		typedef T																value_type;
+		typedef A																allocator_type;
+		typedef typename A::size_type											size_type;
+		typedef typename A::difference_type										difference_type;
+		typedef typename A::pointer												pointer;
+		typedef typename A::const_pointer										const_pointer;
+		typedef typename A::reference											reference;
+		typedef typename A::const_reference										const_reference;
+		typedef ft::deque_iterator< T, false >									iterator;
+		typedef ft::deque_iterator< T, true >									const_iterator;
+		typedef typename ft::reverse_iterator< iterator >						reverse_iterator;
+		typedef typename ft::reverse_iterator< const_iterator >					const_reverse_iterator;
+
+	private:
+		typedef typename A::template rebind<pointer>::other						map_allocator;
+
+		static const size_type	block_size = ft::deque_block<T>::size;
+
+	public:
+		explicit deque( const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _map(NULL), _map_size(0), _start(0), _size(0), _spare(NULL) {};
+
+		explicit deque( size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _map(NULL), _map_size(0), _start(0), _size(0), _spare(NULL)
+		{
+			assign(n, val);
+		};
+
+		template <class InputIterator>
+		deque( InputIterator first, InputIterator last,
+				const allocator_type& alloc = allocator_type(), typename enable_if< !is_integral<InputIterator>::value >::type* = 0 ) : _allocker(alloc), _map(NULL), _map_size(0), _start(0), _size(0), _spare(NULL)
+		{
+			assign(first, last);
+		}
+
+		deque( const deque & x ) : _allocker(x._allocker), _map(NULL), _map_size(0), _start(0), _size(0), _spare(NULL)
+		{
+			assign(x.begin(), x.end());
+		};
+
+#if __cplusplus >= 201103L
+		deque( deque && x ) noexcept : _allocker(x._allocker), _map(x._map), _map_size(x._map_size), _start(x._start), _size(x._size), _spare(x._spare)
+		{
+			x._map = NULL;
+			x._map_size = 0;
+			x._start = 0;
+			x._size = 0;
+			x._spare = NULL;
+		};
+
+		deque &	operator=( deque && x ) noexcept
+		{
+			if (this != &x)
+			{
+				deque	tmp(std::move(x));
+
+				swap(tmp);
+			}
+			return (*this);
+		};
+#endif
+
+		~deque( void )
+		{
+			clear();
+			if (_spare)
+				_allocker.deallocate(_spare, block_size);
+			_map_allocker().deallocate(_map, _map_size);
+		};
+
+		deque &	operator=( const deque & x )
+		{
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return (*this);
+		};
+
+		//ITERATOR BASED FCT
+		iterator				begin( void ) { return (iterator(_map + _start / block_size, _start % block_size)); };
+		iterator				end( void ) { return (iterator(_map + (_start + _size) / block_size, (_start + _size) % block_size)); };
+		const_iterator			begin( void ) const { return (const_iterator(_map + _start / block_size, _start % block_size)); };
+		const_iterator			end( void ) const { return (const_iterator(_map + (_start + _size) / block_size, (_start + _size) % block_size)); };
+		reverse_iterator		rbegin( void ) { return (reverse_iterator(end())); };
+		reverse_iterator		rend( void ) { return (reverse_iterator(begin())); };
+		const_reverse_iterator	rbegin( void ) const { return (const_reverse_iterator(end())); };
+		const_reverse_iterator	rend( void ) const { return (const_reverse_iterator(begin())); };
+
+		//ACCESS
+		reference		operator[]( size_type n ) { return (_at(_start + n)); };
+		const_reference	operator[]( size_type n ) const { return (_at(_start + n)); };
+		reference		at( size_type n )
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::deque::at");
+			return (_at(_start + n));
+		};
+		const_reference	at( size_type n ) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::deque::at");
+			return (_at(_start + n));
+		};
+		reference		front( void ) { return (_at(_start)); };
+		const_reference	front( void ) const { return (_at(_start)); };
+		reference		back( void ) { return (_at(_start + _size - 1)); };
+		const_reference	back( void ) const { return (_at(_start + _size - 1)); };
+
+		//CAPACITY
+		size_type		size( void ) const { return (_size); };
+		size_type		max_size( void ) const { return (_allocker.max_size()); };
+		bool			empty( void ) const { return (_size == 0); };
+		allocator_type	get_allocator( void ) const { return (_allocker); };
+
+		void	resize( size_type n, value_type val = value_type() )
+		{
+			while (_size > n)
+				pop_back();
+			while (_size < n)
+				push_back(val);
+		};
+
+		//MODIFIERS
+		//val may be an element: blocks never move, it stays valid
+		void	push_back( const value_type & val )
+		{
+			_allocker.construct(_back_slot(), val);
+			_size++;
+		};
+
+		void	push_front( const value_type & val )
+		{
+			_allocker.construct(_front_slot(), val);
+			_start--;
+			_size++;
+		};
+
+#if __cplusplus >= 201103L
+		void	push_back( value_type && val ) { emplace_back(std::move(val)); }
+		void	push_front( value_type && val ) { emplace_front(std::move(val)); }
+
+		template <class... Args>
+		void	emplace_back( Args&&... args )
+		{
+			_allocker.construct(_back_slot(), std::forward<Args>(args)...);
+			_size++;
+		}
+
+		template <class... Args>
+		void	emplace_front( Args&&... args )
+		{
+			_allocker.construct(_front_slot(), std::forward<Args>(args)...);
+			_start--;
+			_size++;
+		}
+
+		template <class... Args>
+		iterator	emplace( iterator position, Args&&... args )
+		{
+			return (insert(position, value_type(std::forward<Args>(args)...)));
+		}
+
+		iterator	insert( iterator position, value_type && val )
+		{
+			size_type	offset = position - begin();
+
+			if (offset < _size / 2)
+			{
+				push_front(std::move(val));
+				std::rotate(begin(), begin() + 1, begin() + offset + 1);
+			}
+			else
+			{
+				push_back(std::move(val));
+				std::rotate(begin() + offset, end() - 1, end());
+			}
+			return (begin() + offset);
+		}
+#endif
+
+		void	pop_back( void )
+		{
+			if (_size == 0)
+				return;
+
+			size_type	pos = _start + _size - 1;
+
+			_allocker.destroy(&_at(pos));
+			_size--;
+			if (_size == 0 || (pos - 1) / block_size != pos / block_size)
+				_release_block(pos / block_size);
+		};
+
+		void	pop_front( void )
+		{
+			if (_size == 0)
+				return;
+
+			size_type	pos = _start;
+
+			_allocker.destroy(&_at(pos));
+			_start++;
+			_size--;
+			if (_size == 0 || _start / block_size != pos / block_size)
+				_release_block(pos / block_size);
+		};
+
+		iterator	insert( iterator position, const value_type & val )
+		{
+			size_type	offset = position - begin();
+
+			insert(position, 1, val);
+			return (begin() + offset);
+		};
+
+		//new elements are added at the closer end, then rotated into place
+		void	insert( iterator position, size_type n, const value_type & val )
+		{
+			size_type	offset = position - begin();
+			value_type	copy(val);
+
+			if (offset < _size / 2)
+			{
+				for (size_type i = 0; i != n; i++)
+					push_front(copy);
+				std::rotate(begin(), begin() + n, begin() + n + offset);
+			}
+			else
+			{
+				for (size_type i = 0; i != n; i++)
+					push_back(copy);
+				std::rotate(begin() + offset, end() - n, end());
+			}
+		};
+
+		template <class InputIterator>
+		void	insert( iterator position, InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			size_type	offset = position - begin();
+			size_type	old_size = _size;
+
+			for (; first != last; ++first)
+				push_back(*first);
+			std::rotate(begin() + offset, begin() + old_size, end());
+		}
+
+		iterator	erase( iterator position ) { return (erase(position, position + 1)); };
+
+		//the shorter side is shifted over the hole
+		iterator	erase( iterator first, iterator last )
+		{
+			size_type	offset = first - begin();
+			size_type	n = last - first;
+
+			if (n == 0)
+				return (first);
+			if (offset < _size - offset - n)
+			{
+				_shift(begin(), first, last, true);
+				for (size_type i = 0; i != n; i++)
+					pop_front();
+			}
+			else
+			{
+				_shift(last, end(), first, false);
+				for (size_type i = 0; i != n; i++)
+					pop_back();
+			}
+			return (begin() + offset);
+		};
+
+		template <class InputIterator>
+		void	assign( InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			clear();
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		void	assign( size_type n, const value_type & val )
+		{
+			value_type	copy(val);
+
+			clear();
+			for (size_type i = 0; i != n; i++)
+				push_back(copy);
+		};
+
+		void	swap( deque & x )
+		{
+			std::swap(_allocker, x._allocker);
+			std::swap(_map, x._map);
+			std::swap(_map_size, x._map_size);
+			std::swap(_start, x._start);
+			std::swap(_size, x._size);
+			std::swap(_spare, x._spare);
+		};
+
+		void	clear( void )
+		{
+			while (_size)
+				pop_back();
+			_start = _map_size / 2 * block_size;
+		};
+
+	private:
+		map_allocator	_map_allocker( void ) const { return (map_allocator(_allocker)); };
+
+		reference		_at( size_type pos ) const { return (_map[pos / block_size][pos % block_size]); };
+
+		pointer	_new_block( void )
+		{
+			pointer	block = _spare;
+
+			if (block)
+				_spare = NULL;
+			else
+				block = _allocker.allocate(block_size);
+			return (block);
+		};
+
+		//the last freed block is kept, pushing and popping across a block
+		//boundary does not hit the allocator every time
+		void	_release_block( size_type index )
+		{
+			if (_spare)
+				_allocker.deallocate(_map[index], block_size);
+			else
+				_spare = _map[index];
+			_map[index] = NULL;
+			if (_size == 0)
+				_start = _map_size / 2 * block_size;
+		};
+
+		//raw slot for a new last element, the block map and the block are
+		//made if needed
+		pointer	_back_slot( void )
+		{
+			if ((_start + _size) / block_size >= _map_size)
+				_recenter_map();
+
+			size_type	pos = _start + _size;
+
+			if (!_map[pos / block_size])
+				_map[pos / block_size] = _new_block();
+			return (&_map[pos / block_size][pos % block_size]);
+		};
+
+		pointer	_front_slot( void )
+		{
+			if (_start == 0)
+				_recenter_map();
+
+			size_type	pos = _start - 1;
+
+			if (!_map[pos / block_size])
+				_map[pos / block_size] = _new_block();
+			return (&_map[pos / block_size][pos % block_size]);
+		};
+
+		//moves the used blocks to the middle of a new map, twice as big unless
+		//half of the current one is free. Only block pointers are copied
+		void	_recenter_map( void )
+		{
+			size_type	first = _start / block_size;
+			size_type	used = _size ? (_start + _size - 1) / block_size - first + 1 : 0;
+			size_type	new_size = _map_size;
+
+			if (new_size < 2 * (used + 1))
+				new_size = 2 * _map_size > used + 2 ? 2 * _map_size : used + 2;
+			if (new_size < 8)
+				new_size = 8;
+
+			pointer		*new_map = _map_allocker().allocate(new_size);
+			size_type	new_first = (new_size - used) / 2;
+
+			for (size_type i = 0; i != new_size; i++)
+				new_map[i] = NULL;
+			for (size_type i = 0; i != used; i++)
+				new_map[new_first + i] = _map[first + i];
+			_map_allocker().deallocate(_map, _map_size);
+			_map = new_map;
+			_map_size = new_size;
+			if (_size)
+				_start = new_first * block_size + _start % block_size;
+			else
+				_start = new_size / 2 * block_size;
+		};
+
+		//copies [first, last) so that it ends at dest (backward) or starts
+		//at dest (forward)
+		void	_shift( iterator first, iterator last, iterator dest, bool backward )
+		{
+#if __cplusplus >= 201103L
+			if (backward)
+				std::move_backward(first, last, dest);
+			else
+				std::move(first, last, dest);
+#else
+			if (backward)
+				std::copy_backward(first, last, dest);
+			else
+				std::copy(first, last, dest);
+#endif
+		};
+
+		allocator_type	_allocker;
+		pointer			*_map;
+		size_type		_map_size;
+		size_type		_start;
+		size_type		_size;
+		pointer			_spare;
+};
+
+template < typename T, typename A >
+const typename deque<T, A>::size_type	deque<T, A>::block_size;
+
+//NON-MEMBER
+template <class T, class Alloc>
+void swap( ft::deque<T,Alloc>& x, ft::deque<T,Alloc>& y )
+{
+	x.swap(y);
+}
+
+template <class T, class Alloc>
+bool operator==( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	for (typename ft::deque<T,Alloc>::size_type i = 0; i != lhs.size(); i++)
+	{
+		if (!(lhs[i] == rhs[i]))
+			return false;
+	}
+	return true;
+}
+
+template <class T, class Alloc>
+bool operator!=( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs ) { return (!(lhs == rhs)); }
+
+template <class T, class Alloc>
+bool operator<( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs )
+{
+	return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+template <class T, class Alloc>
+bool operator>( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs ) { return (rhs < lhs); }
+
+template <class T, class Alloc>
+bool operator<=( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs ) { return (!(rhs < lhs)); }
+
+template <class T, class Alloc>
+bool operator>=( const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs ) { return (!(lhs < rhs)); }
+
+}
+
+#endif
@@ -0,0 +1,396 @@
+#ifndef __FLAT_MAP_HPP__
+# define __FLAT_MAP_HPP__
+
+# include "containers.hpp"
+# include "utils/utils.hpp"
+# include "vector.hpp"
+
+namespace ft{
+
+//ft::map's interface over a vector of pairs sorted by key. Lookups are a
+//binary search over contiguous memory, inserting and erasing shift the
+//elements after the position. Any insert or erase invalidates iterators.
+//value_type is pair<Key, T>, not pair<const Key, T>, so that the vector
+//can shift it: a key must not be changed through an iterator
+template < class Key,
+			class T,
+			class Compare = ft::less< Key >,
+			class Alloc = std::allocator< ft::pair<const Key,T> >
+			>
+class flat_map
+{
+	public:
+		typedef Key																		key_type;
+		typedef T																		mapped_type;
+		typedef ft::pair< Key, T >														value_type;
+		typedef Compare																	key_compare;
+		typedef Alloc																	allocator_type;
+		typedef typename Alloc::template rebind< value_type >::other					vector_allocator_type;
+		typedef ft::vector< value_type, vector_allocator_type >							vector_type;
+		typedef typename vector_type::size_type											size_type;
+		typedef typename vector_type::difference_type									difference_type;
+		typedef typename vector_type::reference											reference;
+		typedef typename vector_type::const_reference									const_reference;
+		typedef typename vector_type::pointer											pointer;
+		typedef typename vector_type::const_pointer										const_pointer;
+		typedef typename vector_type::iterator											iterator;
+		typedef typename vector_type::const_iterator									const_iterator;
+		typedef typename vector_type::reverse_iterator									reverse_iterator;
+		typedef typename vector_type::const_reverse_iterator							const_reverse_iterator;
+
+		class value_compare
+		{
+			friend class flat_map;
+			protected:
+				Compare comp;
+				value_compare (Compare c) : comp(c) {}
+			public:
+				typedef bool result_type;
+				typedef value_type first_argument_type;
+				typedef value_type second_argument_type;
+				bool operator() (const value_type& x, const value_type& y) const
+				{
+					return comp(x.first, y.first);
+				}
+		};
+
+	private:
+		//on a sorted range, neighbours are equivalent when the first is not less
+		class same_key
+		{
+			public:
+				same_key (Compare c) : comp(c) {}
+				bool operator() (const value_type& x, const value_type& y) const
+				{
+					return !comp(x.first, y.first);
+				}
+			private:
+				Compare comp;
+		};
+
+		key_compare		_compare;
+		vector_type		_data;
+
+	public:
+		explicit flat_map (const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _compare(comp), _data(vector_allocator_type(alloc)) {}
+
+		flat_map (const flat_map& x) : _compare(x._compare), _data(x._data) {}
+
+		//bulk load: one copy, a stable sort and a dedup keeping the first of
+		//equal keys, as inserting them one by one would
+		template <class InputIterator>
+		flat_map (InputIterator first, InputIterator last,
+		const key_compare& comp = key_compare(),
+		const allocator_type& alloc = allocator_type()) : _compare(comp), _data(first, last, vector_allocator_type(alloc)) {
+			sort_unique(0);
+		}
+
+#if __cplusplus >= 201103L
+		flat_map (flat_map&& x) : _compare(x._compare), _data(std::move(x._data)) {}
+#endif
+
+		~flat_map( void ) {}
+
+		flat_map&	operator=(const flat_map& x) {
+			if (this != &x)
+			{
+				_compare = x._compare;
+				_data = x._data;
+			}
+			return (*this);
+		}
+
+#if __cplusplus >= 201103L
+		flat_map&	operator=(flat_map&& x) {
+			if (this != &x)
+			{
+				_compare = x._compare;
+				_data = std::move(x._data);
+			}
+			return (*this);
+		}
+#endif
+
+	private:
+		//index of the first element whose key is not less than k. The loop
+		//has no data dependent branch: the halving only depends on size()
+		//and the compare result picks the next base with a conditional move
+		size_type	lower_index( const key_type& k ) const
+		{
+			const value_type	*base = _data.data();
+			size_type			n = _data.size();
+
+			if (n == 0)
+				return 0;
+			while (n > 1)
+			{
+				size_type	half = n / 2;
+
+				base = _compare(base[half].first, k) ? base + half : base;
+				n -= half;
+			}
+			return (base - _data.data() + _compare(base->first, k));
+		}
+
+		//index of the first element whose key is greater than k
+		size_type	upper_index( const key_type& k ) const
+		{
+			const value_type	*base = _data.data();
+			size_type			n = _data.size();
+
+			if (n == 0)
+				return 0;
+			while (n > 1)
+			{
+				size_type	half = n / 2;
+
+				base = _compare(k, base[half].first) ? base : base + half;
+				n -= half;
+			}
+			return (base - _data.data() + !_compare(k, base->first));
+		}
+
+		//lower_index(k) when it holds k, size() otherwise
+		size_type	find_index( const key_type& k ) const
+		{
+			size_type	i = lower_index(k);
+
+			if (i != _data.size() && _compare(k, _data[i].first))
+				return (_data.size());
+			return (i);
+		}
+
+		bool	holds( size_type i, const key_type& k ) const
+		{
+			return (i != _data.size() && !_compare(k, _data[i].first));
+		}
+
+		//sorts and dedups the elements from index from on, which are newer
+		//than the ones before it, then merges both runs. Sorted unique input
+		//costs a single pass
+		void	sort_unique( size_type from )
+		{
+			value_type		*first = _data.data();
+			value_type		*mid = first + from;
+			value_type		*last = first + _data.size();
+			value_compare	comp(_compare);
+			bool			unique = strictly_sorted(mid, last);
+
+			if (mid == last)
+				return ;
+			if (!unique)
+				std::stable_sort(mid, last, comp);
+			//merging is stable, on equal keys the older element comes first
+			if (mid != first && !comp(*(mid - 1), *mid))
+			{
+				std::inplace_merge(first, mid, last, comp);
+				mid = first;
+				unique = false;
+			}
+			if (!unique)
+				_data.erase(_data.begin() + (std::unique(mid, last, same_key(_compare)) - first), _data.end());
+		}
+
+		bool	strictly_sorted( const value_type * first, const value_type * last ) const
+		{
+			if (first == last)
+				return true;
+			for (first++; first != last; first++)
+			{
+				if (!_compare((first - 1)->first, first->first))
+					return false;
+			}
+			return true;
+		}
+
+	public:
+		ft::pair<iterator,bool> insert (const value_type& val){
+			size_type	i = lower_index(val.first);
+
+			if (holds(i, val.first))
+				return (ft::make_pair(begin() + i, false));
+			return (ft::make_pair(_data.insert(begin() + i, val), true));
+		}
+
+		//same contract as ft::map: val goes right before position when it
+		//fits there, otherwise we fall back on a binary search
+		iterator insert (iterator position, const value_type& val)
+		{
+			if ((position == begin() || _compare((position - 1)->first, val.first))
+				&& (position == end() || _compare(val.first, position->first)))
+				return (_data.insert(position, val));
+			return (insert(val).first);
+		}
+
+		//appended at the end, then sorted and merged with what was there
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last){
+			size_type	from = _data.size();
+
+			_data.insert(_data.end(), first, last);
+			sort_unique(from);
+		}
+
+#if __cplusplus >= 201103L
+		ft::pair<iterator,bool> insert (value_type&& val) {
+			size_type	i = lower_index(val.first);
+
+			if (holds(i, val.first))
+				return (ft::make_pair(begin() + i, false));
+			return (ft::make_pair(_data.emplace(begin() + i, std::move(val)), true));
+		}
+
+		//the pair has to exist before its key can be looked up
+		template <class... Args>
+		ft::pair<iterator,bool> emplace (Args&&... args) {
+			return (insert(value_type(std::forward<Args>(args)...)));
+		}
+
+		//args are left untouched when k is already there
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (const key_type& k, Args&&... args) {
+			return (emplace_unique(k, k, std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (key_type&& k, Args&&... args) {
+			return (emplace_unique(k, std::move(k), std::forward<Args>(args)...));
+		}
+
+	private:
+		template <class K, class... Args>
+		ft::pair<iterator,bool>	emplace_unique( const key_type& k, K&& key, Args&&... args )
+		{
+			size_type	i = lower_index(k);
+
+			if (holds(i, k))
+				return (ft::make_pair(begin() + i, false));
+			return (ft::make_pair(_data.emplace(begin() + i, std::forward<K>(key), mapped_type(std::forward<Args>(args)...)), true));
+		}
+
+	public:
+#endif
+		void		erase( iterator position ) { _data.erase(position); }
+
+		void		erase(iterator first, iterator last) { _data.erase(first, last); }
+
+		size_type	erase(const key_type & k)
+		{
+			size_type	i = find_index(k);
+
+			if (i == _data.size())
+				return 0;
+			_data.erase(begin() + i);
+			return 1;
+		}
+
+	//ITERATORS//
+	public:
+		iterator				begin( void ) { return (_data.begin()); }
+		const_iterator			begin( void ) const { return (_data.begin()); }
+		iterator				end( void ) { return (_data.end()); }
+		const_iterator			end( void ) const { return (_data.end()); }
+		reverse_iterator		rbegin( void ) { return (_data.rbegin()); }
+		reverse_iterator		rend( void ) { return (_data.rend()); }
+		const_reverse_iterator	rbegin( void ) const { return (_data.rbegin()); }
+		const_reverse_iterator	rend( void ) const { return (_data.rend()); }
+
+		iterator		find (const key_type& k) { return (begin() + find_index(k)); }
+		const_iterator	find (const key_type& k) const { return (begin() + find_index(k)); }
+		size_type		count (const key_type& k) const { return (find_index(k) != _data.size()); }
+
+		iterator		lower_bound (const key_type& k) { return (begin() + lower_index(k)); }
+		const_iterator	lower_bound (const key_type& k) const { return (begin() + lower_index(k)); }
+		iterator		upper_bound (const key_type& k) { return (begin() + upper_index(k)); }
+		const_iterator	upper_bound (const key_type& k) const { return (begin() + upper_index(k)); }
+
+		//keys are unique: the range holds lower_bound(k) or nothing
+		ft::pair<iterator,iterator>				equal_range (const key_type& k){
+			size_type	i = lower_index(k);
+
+			return (ft::make_pair(begin() + i, begin() + i + holds(i, k)));
+		}
+
+		ft::pair<const_iterator,const_iterator>	equal_range (const key_type& k) const{
+			size_type	i = lower_index(k);
+
+			return (ft::make_pair(begin() + i, begin() + i + holds(i, k)));
+		}
+
+		mapped_type& operator[] (const key_type& k)
+		{
+			size_type	i = lower_index(k);
+
+			if (!holds(i, k))
+				_data.insert(begin() + i, value_type(k, mapped_type()));
+			return (_data[i].second);
+		}
+
+#if __cplusplus >= 201103L
+		mapped_type& operator[] (key_type&& k)
+		{
+			return (*(try_emplace(std::move(k)).first)).second;
+		}
+#endif
+
+	public:
+		void			clear() { _data.clear(); }
+		size_type		size( void ) const { return _data.size(); }
+		size_type		max_size() const { return _data.max_size(); }
+		bool			empty( void ) const { return _data.empty(); }
+		allocator_type	get_allocator( void ) const { return allocator_type(_data.get_allocator()); }
+		key_compare		key_comp() const { return _compare; }
+		value_compare	value_comp() const { return value_compare(_compare); }
+		void			swap (flat_map& x) {
+			std::swap(_compare, x._compare);
+			_data.swap(x._data);
+		}
+
+		//a table built once can give back the slack of its growth
+		size_type		capacity( void ) const { return _data.capacity(); }
+		void			reserve( size_type n ) { _data.reserve(n); }
+		void			shrink_to_fit( void ) { _data.shrink_to_fit(); }
+
+		//the sorted pairs themselves
+		const vector_type &	sequence( void ) const { return _data; }
+};
+
+template <class Key, class T, class Compare, class Alloc>
+void swap (flat_map<Key,T,Compare,Alloc>& x, flat_map<Key,T,Compare,Alloc>& y){
+	x.swap(y);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator== ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (lhs.sequence() == rhs.sequence());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator!= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(lhs == rhs));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<  ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (lhs.sequence() < rhs.sequence());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(rhs < lhs));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>  ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>= ( const flat_map<Key,T,Compare,Alloc>& lhs, const flat_map<Key,T,Compare,Alloc>& rhs ){
+	return (!(lhs < rhs));
+}
+
+}
+
+#endif
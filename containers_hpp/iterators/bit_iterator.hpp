@@ -0,0 +1,165 @@
+#ifndef __BIT_ITERATOR_HPP__
+# define __BIT_ITERATOR_HPP__
+
+# include <cstddef>
+# include <climits>
+# include <iterator>
+# include "../utils/traits.hpp"
+
+namespace ft{
+
+//storage unit of ft::vector<bool>, bit i lives in word i / bits_per_word
+typedef unsigned long	bit_word;
+
+static const std::size_t	bits_per_word = sizeof(bit_word) * CHAR_BIT;
+
+inline std::size_t	popcount_word( bit_word w )
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (__builtin_popcountl(w));
+#else
+	std::size_t	n = 0;
+
+	for (; w; w &= w - 1)
+		n++;
+	return (n);
+#endif
+}
+
+//index of the lowest set bit, w must not be 0
+inline std::size_t	ctz_word( bit_word w )
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (__builtin_ctzl(w));
+#else
+	std::size_t	n = 0;
+
+	for (; !(w & 1); w >>= 1)
+		n++;
+	return (n);
+#endif
+}
+
+//what vector<bool>::operator[] returns: one bit of a word, usable as a bool
+class bit_reference
+{
+	public:
+		bit_reference( bit_word * word, bit_word mask ) : _word(word), _mask(mask) {};
+
+		operator bool( void ) const { return ((*_word & _mask) != 0); };
+		bool			operator~( void ) const { return ((*_word & _mask) == 0); };
+
+		bit_reference &	operator=( bool x )
+		{
+			if (x)
+				*_word |= _mask;
+			else
+				*_word &= ~_mask;
+			return (*this);
+		};
+		bit_reference &	operator=( bit_reference const & x ) { return (*this = bool(x)); };
+
+		void			flip( void ) { *_word ^= _mask; };
+
+	private:
+		bit_word	*_word;
+		bit_word	_mask;
+};
+
+template < bool isConst = false >
+class bit_iterator
+{
+	public:
+		typedef bool																	value_type;
+		typedef std::ptrdiff_t															difference_type;
+		typedef std::random_access_iterator_tag											iterator_category;
+		typedef typename ft::conditional< isConst, bool, bit_reference >::type			reference;
+		typedef typename ft::conditional< isConst, const bool *, bit_reference * >::type	pointer;
+		typedef typename ft::conditional< isConst, const bit_word *, bit_word * >::type	word_pointer;
+
+	public:
+		bit_iterator( void ) : _word(NULL), _bit(0) {};
+		bit_iterator( word_pointer word, std::size_t bit ) : _word(word), _bit(bit) {};
+		bit_iterator( bit_iterator const & src ) : _word(src._word), _bit(src._bit) {};
+		//iterator -> const_iterator only, never the way back
+		template <bool B>
+		bit_iterator( bit_iterator<B> const & src, typename ft::enable_if<!B, int>::type = 0 ) : _word(src.word()), _bit(src.bit()) {}
+
+		bit_iterator &	operator=( bit_iterator const & src )
+		{
+			_word = src._word;
+			_bit = src._bit;
+			return (*this);
+		};
+
+		word_pointer	word( void ) const { return (_word); };
+		std::size_t		bit( void ) const { return (_bit); };
+
+		reference		operator*( void ) const { return (_deref(ft::integral_constant<bool, isConst>())); };
+		reference		operator[]( difference_type n ) const { return (*(*this + n)); };
+
+		bit_iterator &	operator++( void )
+		{
+			if (++_bit == bits_per_word)
+			{
+				_bit = 0;
+				++_word;
+			}
+			return (*this);
+		};
+		bit_iterator &	operator--( void )
+		{
+			if (_bit-- == 0)
+			{
+				_bit = bits_per_word - 1;
+				--_word;
+			}
+			return (*this);
+		};
+		bit_iterator	operator++( int ) { bit_iterator tmp(*this); ++*this; return (tmp); };
+		bit_iterator	operator--( int ) { bit_iterator tmp(*this); --*this; return (tmp); };
+
+		bit_iterator &	operator+=( difference_type n )
+		{
+			difference_type	pos = static_cast<difference_type>(_bit) + n;
+			difference_type	words = pos / static_cast<difference_type>(bits_per_word);
+
+			pos %= static_cast<difference_type>(bits_per_word);
+			if (pos < 0)
+			{
+				pos += bits_per_word;
+				words--;
+			}
+			_word += words;
+			_bit = pos;
+			return (*this);
+		};
+		bit_iterator &	operator-=( difference_type n ) { return (*this += -n); };
+		bit_iterator	operator+( difference_type n ) const { bit_iterator tmp(*this); return (tmp += n); };
+		bit_iterator	operator-( difference_type n ) const { bit_iterator tmp(*this); return (tmp -= n); };
+		friend bit_iterator	operator+( difference_type n, bit_iterator const & it ) { return (it + n); };
+
+		difference_type	operator-( bit_iterator const & x ) const
+		{
+			return ((_word - x._word) * static_cast<difference_type>(bits_per_word)
+				+ static_cast<difference_type>(_bit) - static_cast<difference_type>(x._bit));
+		};
+
+		friend bool	operator==( bit_iterator const & lhs, bit_iterator const & rhs ) { return (lhs._word == rhs._word && lhs._bit == rhs._bit); };
+		friend bool	operator!=( bit_iterator const & lhs, bit_iterator const & rhs ) { return (!(lhs == rhs)); };
+		friend bool	operator<( bit_iterator const & lhs, bit_iterator const & rhs ) { return (lhs - rhs < 0); };
+		friend bool	operator>( bit_iterator const & lhs, bit_iterator const & rhs ) { return (rhs < lhs); };
+		friend bool	operator<=( bit_iterator const & lhs, bit_iterator const & rhs ) { return (!(rhs < lhs)); };
+		friend bool	operator>=( bit_iterator const & lhs, bit_iterator const & rhs ) { return (!(lhs < rhs)); };
+
+	private:
+		bool			_deref( ft::true_type ) const { return (((*_word >> _bit) & 1) != 0); };
+		bit_reference	_deref( ft::false_type ) const { return (bit_reference(_word, bit_word(1) << _bit)); };
+
+		word_pointer	_word;
+		std::size_t		_bit;
+};
+
+}
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef __BTREE_ITERATOR_HPP__
+# define __BTREE_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+# include "../utils/traits.hpp"
+# include "../btree/btree_node.hpp"
+
+namespace ft{
+
+//a leaf of the chain and a slot in it. end() is the header of the chain,
+//so both directions only follow the leaf links, never a parent
+template < typename Leaf, typename T, bool isConst = false >
+class btree_iterator
+{
+	public:
+		typedef T																	value_type;
+		typedef std::ptrdiff_t														difference_type;
+		typedef std::bidirectional_iterator_tag										iterator_category;
+		typedef typename ft::conditional< isConst, const T &, T & >::type			reference;
+		typedef typename ft::conditional< isConst, const T *, T * >::type			pointer;
+
+	public:
+		btree_iterator( void ) : _node(NULL), _index(0) {};
+		btree_iterator( btree_links * node, std::size_t index ) : _node(node), _index(index) {};
+		btree_iterator( btree_iterator const & src ) : _node(src._node), _index(src._index) {};
+		//iterator -> const_iterator only, never the way back
+		template <bool B>
+		btree_iterator( btree_iterator<Leaf, T, B> const & src, typename ft::enable_if<!B, int>::type = 0 ) : _node(src.node()), _index(src.index()) {}
+
+		btree_iterator &	operator=( btree_iterator const & src )
+		{
+			_node = src._node;
+			_index = src._index;
+			return (*this);
+		};
+
+		btree_links *	node( void ) const { return (_node); };
+		std::size_t		index( void ) const { return (_index); };
+		Leaf *			leaf( void ) const { return (static_cast<Leaf *>(_node)); };
+
+		reference		operator*( void ) const { return (leaf()->slots()[_index]); };
+		pointer			operator->( void ) const { return (&leaf()->slots()[_index]); };
+
+		btree_iterator &	operator++( void )
+		{
+			if (++_index == leaf()->count)
+			{
+				_node = _node->next;
+				_index = 0;
+			}
+			return (*this);
+		};
+		btree_iterator &	operator--( void )
+		{
+			if (_index == 0)
+			{
+				_node = _node->prev;
+				_index = leaf()->count;
+			}
+			--_index;
+			return (*this);
+		};
+		btree_iterator	operator++( int ) { btree_iterator tmp(*this); ++*this; return (tmp); };
+		btree_iterator	operator--( int ) { btree_iterator tmp(*this); --*this; return (tmp); };
+
+		friend bool	operator==( btree_iterator const & lhs, btree_iterator const & rhs ) { return (lhs._node == rhs._node && lhs._index == rhs._index); };
+		friend bool	operator!=( btree_iterator const & lhs, btree_iterator const & rhs ) { return (!(lhs == rhs)); };
+
+	private:
+		btree_links		*_node;
+		std::size_t		_index;
+};
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef __DEQUE_ITERATOR_HPP__
+# define __DEQUE_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+# include "../utils/traits.hpp"
+
+namespace ft{
+
+//elements per block of ft::deque: 4 KB blocks, at least 16 elements
+template < typename T >
+struct deque_block
+{
+	static const std::size_t	size = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+};
+
+template < typename T >
+const std::size_t	deque_block<T>::size;
+
+//a slot of the block map and an offset in that block. Moving never reads
+//the map, so end() may sit on a slot past the last block
+template < typename T, bool isConst = false >
+class deque_iterator
+{
+	public:
+		typedef T																	value_type;
+		typedef std::ptrdiff_t														difference_type;
+		typedef std::random_access_iterator_tag										iterator_category;
+		typedef typename ft::conditional< isConst, const T &, T & >::type			reference;
+		typedef typename ft::conditional< isConst, const T *, T * >::type			pointer;
+		typedef T **																map_pointer;
+
+	public:
+		deque_iterator( void ) : _node(NULL), _offset(0) {};
+		deque_iterator( map_pointer node, std::size_t offset ) : _node(node), _offset(offset) {};
+		deque_iterator( deque_iterator const & src ) : _node(src._node), _offset(src._offset) {};
+		//iterator -> const_iterator only, never the way back
+		template <bool B>
+		deque_iterator( deque_iterator<T, B> const & src, typename ft::enable_if<!B, int>::type = 0 ) : _node(src.node()), _offset(src.offset()) {}
+
+		deque_iterator &	operator=( deque_iterator const & src )
+		{
+			_node = src._node;
+			_offset = src._offset;
+			return (*this);
+		};
+
+		map_pointer		node( void ) const { return (_node); };
+		std::size_t		offset( void ) const { return (_offset); };
+
+		reference		operator*( void ) const { return ((*_node)[_offset]); };
+		pointer			operator->( void ) const { return (&(*_node)[_offset]); };
+		reference		operator[]( difference_type n ) const { return (*(*this + n)); };
+
+		deque_iterator &	operator++( void )
+		{
+			if (++_offset == deque_block<T>::size)
+			{
+				_offset = 0;
+				++_node;
+			}
+			return (*this);
+		};
+		deque_iterator &	operator--( void )
+		{
+			if (_offset-- == 0)
+			{
+				_offset = deque_block<T>::size - 1;
+				--_node;
+			}
+			return (*this);
+		};
+		deque_iterator	operator++( int ) { deque_iterator tmp(*this); ++*this; return (tmp); };
+		deque_iterator	operator--( int ) { deque_iterator tmp(*this); --*this; return (tmp); };
+
+		deque_iterator &	operator+=( difference_type n )
+		{
+			difference_type	block = static_cast<difference_type>(deque_block<T>::size);
+			difference_type	pos = static_cast<difference_type>(_offset) + n;
+			difference_type	nodes = pos / block;
+
+			pos %= block;
+			if (pos < 0)
+			{
+				pos += block;
+				nodes--;
+			}
+			_node += nodes;
+			_offset = pos;
+			return (*this);
+		};
+		deque_iterator &	operator-=( difference_type n ) { return (*this += -n); };
+		deque_iterator		operator+( difference_type n ) const { deque_iterator tmp(*this); return (tmp += n); };
+		deque_iterator		operator-( difference_type n ) const { deque_iterator tmp(*this); return (tmp -= n); };
+		friend deque_iterator	operator+( difference_type n, deque_iterator const & it ) { return (it + n); };
+
+		difference_type	operator-( deque_iterator const & x ) const
+		{
+			return ((_node - x._node) * static_cast<difference_type>(deque_block<T>::size)
+				+ static_cast<difference_type>(_offset) - static_cast<difference_type>(x._offset));
+		};
+
+		friend bool	operator==( deque_iterator const & lhs, deque_iterator const & rhs ) { return (lhs._node == rhs._node && lhs._offset == rhs._offset); };
+		friend bool	operator!=( deque_iterator const & lhs, deque_iterator const & rhs ) { return (!(lhs == rhs)); };
+		friend bool	operator<( deque_iterator const & lhs, deque_iterator const & rhs ) { return (lhs - rhs < 0); };
+		friend bool	operator>( deque_iterator const & lhs, deque_iterator const & rhs ) { return (rhs < lhs); };
+		friend bool	operator<=( deque_iterator const & lhs, deque_iterator const & rhs ) { return (!(rhs < lhs)); };
+		friend bool	operator>=( deque_iterator const & lhs, deque_iterator const & rhs ) { return (!(lhs < rhs)); };
+
+	private:
+		map_pointer	_node;
+		std::size_t	_offset;
+};
+
+}
+
+#endif
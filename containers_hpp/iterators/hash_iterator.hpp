@@ -0,0 +1,73 @@
+#ifndef __HASH_ITERATOR_HPP__
+# define __HASH_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+# include "../utils/traits.hpp"
+# include "../utils/ctrl_group.hpp"
+
+namespace ft{
+
+//a control byte and its slot. The control bytes end with a sentinel, so
+//++ only skips empty and deleted slots and never needs the table
+template < typename T, bool isConst = false >
+class hash_iterator
+{
+	public:
+		typedef T																	value_type;
+		typedef std::ptrdiff_t														difference_type;
+		typedef std::forward_iterator_tag											iterator_category;
+		typedef typename ft::conditional< isConst, const T &, T & >::type			reference;
+		typedef typename ft::conditional< isConst, const T *, T * >::type			pointer;
+
+	public:
+		hash_iterator( void ) : _ctrl(NULL), _slot(NULL) {};
+		//skips to the first full slot from ctrl on
+		hash_iterator( const ctrl_t * ctrl, T * slot ) : _ctrl(ctrl), _slot(slot) { _skip_free(); };
+		hash_iterator( hash_iterator const & src ) : _ctrl(src._ctrl), _slot(src._slot) {};
+		//iterator -> const_iterator only, never the way back
+		template <bool B>
+		hash_iterator( hash_iterator<T, B> const & src, typename ft::enable_if<!B, int>::type = 0 ) : _ctrl(src.ctrl()), _slot(src.slot()) {}
+
+		hash_iterator &	operator=( hash_iterator const & src )
+		{
+			_ctrl = src._ctrl;
+			_slot = src._slot;
+			return (*this);
+		};
+
+		const ctrl_t *	ctrl( void ) const { return (_ctrl); };
+		T *				slot( void ) const { return (_slot); };
+
+		reference		operator*( void ) const { return (*_slot); };
+		pointer			operator->( void ) const { return (_slot); };
+
+		hash_iterator &	operator++( void )
+		{
+			++_ctrl;
+			++_slot;
+			_skip_free();
+			return (*this);
+		};
+		hash_iterator	operator++( int ) { hash_iterator tmp(*this); ++*this; return (tmp); };
+
+		friend bool	operator==( hash_iterator const & lhs, hash_iterator const & rhs ) { return (lhs._ctrl == rhs._ctrl); };
+		friend bool	operator!=( hash_iterator const & lhs, hash_iterator const & rhs ) { return (!(lhs == rhs)); };
+
+	private:
+		void	_skip_free( void )
+		{
+			while (*_ctrl < ctrl_sentinel)
+			{
+				++_ctrl;
+				++_slot;
+			}
+		};
+
+		const ctrl_t	*_ctrl;
+		T				*_slot;
+};
+
+}
+
+#endif
@@ -102,6 +102,7 @@ class reverse_iterator{
 		typedef typename Iterator::pointer			pointer;
 		typedef typename Iterator::reference		reference;
 		typedef typename Iterator::difference_type	difference_type;
+		typedef typename Iterator::iterator_category	iterator_category;
 
 
 	private:
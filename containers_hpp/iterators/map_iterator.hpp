@@ -18,38 +18,23 @@ class MapIterator
 		typedef typename map::difference_type		difference_type;
 		typedef typename map::BST_allocator_type	BST_allocator_type;
 		typedef typename map::BST_pointer			BST_pointer;
+		typedef std::bidirectional_iterator_tag		iterator_category;
 		typedef typename ft::conditional< isConst, typename map::const_reference, typename map::reference >::type	reference;
 		typedef typename ft::conditional< isConst, typename map::const_pointer, typename map::pointer >::type		pointer;
 
 	public:
-		MapIterator( void ) : _it(NULL), _dummy_end(NULL), _out(false), _offset(0) {};
-		MapIterator( BST_pointer root, BST_pointer end, int flag) : _it(root), _dummy_end(end), _out(flag), _offset(flag) { 
-			if (flag)
-			{
-				BST_pointer tmp = _it;
-				
-				_it = _dummy_end;
-				_dummy_end = tmp;
-			}
-		};
+		MapIterator( void ) : _it(NULL) {};
+		explicit MapIterator( BST_pointer node ) : _it(node) {};
 		virtual ~MapIterator( void ) {};
-		MapIterator( MapIterator const & src) : _it(NULL), _dummy_end(NULL), _out(false), _offset(0) {*this = src;};
+		MapIterator( MapIterator const & src) : _it(NULL) {*this = src;};
 		MapIterator & operator=( MapIterator const & src ) {
 			if (this != &src)
-			{
 				_it = src._it;
-				_dummy_end = src._dummy_end;
-				_out = src._out;
-				_offset = src._offset;
-			}
 			return *this;
 		};
 
 		operator MapIterator< const map, true>() const {
-			if (_offset)
-				return MapIterator< const map, true>(_dummy_end, _it, _offset);
-			else
-				return MapIterator< const map, true>(_it, _dummy_end, _offset);
+			return MapIterator< const map, true>(_it);
 		};
 	
 		friend bool	operator==(MapIterator const & lhs, MapIterator const & rhs){
@@ -63,124 +48,21 @@ class MapIterator
 		reference 		operator*( void ) const { return (this->_it->elem); };
 		pointer			operator->( void ) { return (&(this->_it->elem)); };
 		pointer			operator->( void ) const { return (&(this->_it->elem)); };
-		MapIterator& 	operator++( void ) {
-			if (_out)
-			{
-				if (this->_offset == -1)
-				{
-					BST_pointer tmp = _it;	
-					_it = _dummy_end;
-					_dummy_end = tmp;
-
-					this->_out = false;
-					this->_offset = 0;
-				}
-			}
-			else
-			{
-				BST_pointer tmp_it = this->_it;
-				
-				if (this->_it->right)
-				{
-					tmp_it = tmp_it->right;
-					while (tmp_it->left)
-					{
-						tmp_it = tmp_it->left;
-					}
-					_it = tmp_it;
-				}
-				else
-				{
-					tmp_it = tmp_it->parent;
-					while (tmp_it)
-					{
-						if (!comp(tmp_it->elem.first, _it->elem.first))
-							break;
-						tmp_it = tmp_it->parent;
-					}
-					if (tmp_it)
-						this->_it = tmp_it;
-					else
-					{
-						BST_pointer tmp = _it;
-						_it = _dummy_end;
-						_dummy_end = tmp;
 
-						this->_offset = 1;
-						this->_out = true;
-					}
-				}
-			}
-			return (*this); 
-		};
+		//end() is the map header, both directions are pointer walks only
+		MapIterator& 	operator++( void ) { _it = successor(_it); return (*this); };
 		MapIterator		operator++( int ) { 
-			MapIterator tmp(_it, _dummy_end, _offset); operator++(); return tmp; 
-		};
-		MapIterator&	operator--( void ) { 
-			if (_out)
-			{
-				if (this->_offset == 1)
-				{
-					BST_pointer tmp = _it;
-					_it = _dummy_end;
-					_dummy_end = tmp;
-
-					this->_out = false;
-					this->_offset = 0;
-				}
-			}
-			else
-			{
-				BST_pointer tmp_it = this->_it;
-
-				if (this->_it->left)
-				{
-					tmp_it = tmp_it->left;
-					while (tmp_it->right)
-					{
-						tmp_it = tmp_it->right;
-					}
-					_it = tmp_it;
-				}
-				else
-				{
-					tmp_it = tmp_it->parent;
-					while (tmp_it)
-					{
-						if (comp(tmp_it->elem.first, _it->elem.first))
-							break;
-						tmp_it = tmp_it->parent;
-					}
-					if (tmp_it)
-						this->_it = tmp_it;
-					else
-					{
-						BST_pointer tmp = _it;
-						_it = _dummy_end;
-						_dummy_end = tmp;
-
-						this->_out = true;
-						this->_offset = -1;
-					}
-				}
-			}
-			return (*this);
+			MapIterator tmp(*this); operator++(); return tmp; 
 		};
-
+		MapIterator&	operator--( void ) { _it = predecessor(_it); return (*this); };
 		MapIterator		operator--( int ) { 
-			MapIterator tmp(_it, _dummy_end, _offset); operator--(); return tmp;
+			MapIterator tmp(*this); operator--(); return tmp;
 		};
 
 	private:
 		BST_pointer _it;
-		BST_pointer	_dummy_end;
-		key_compare comp;
-		bool		_out;
-		int			_offset;
 
 	public:
-		void		setOut( bool bl) { _out = bl; };
-		void		setOffset( int nb) { _offset = nb; };
 		BST_pointer	base( void ) const { return _it; };
 
 };
@@ -3,6 +3,7 @@
 
 # include "containers.hpp"
 # include "utils/utils.hpp"
+# include "utils/node_pool_allocator.hpp"
 # include "bst/bst.hpp"
 # include "iterators/map_iterator.hpp"
 
@@ -31,7 +32,8 @@ class map
 		typedef typename ft::MapIterator< const map<Key, T, Compare, Alloc>, true >		const_iterator;
 		typedef typename ft::reverse_iterator<iterator>									reverse_iterator;
 		typedef typename ft::reverse_iterator<const_iterator>							const_reverse_iterator;
-		typedef typename std::allocator< BST< value_type, key_compare > >				BST_allocator_type;
+		typedef BST< value_type, key_compare >											BST_type;
+		typedef typename Alloc::template rebind< BST_type >::other						BST_allocator_type;
 		typedef typename BST_allocator_type::pointer									BST_pointer;
 	
 	private:
@@ -54,65 +56,108 @@ class map
 		key_compare							_compare;
 		allocator_type						_allocker;
 		size_type							_size;
-		BST_pointer							_bst;
 		BST_allocator_type					_bst_allocker;
-		BST_pointer							_dummy_end;
+		BST_pointer							_header;
 
 	private:
-		void	init_dummy( void )
+		//the header is never constructed, only its links are used:
+		//parent is the root, left the leftmost node, right the rightmost one
+		void	init_header( void )
 		{
-			_dummy_end = _bst_allocker.allocate(1);
+			_header = _bst_allocker.allocate(1);
+			reset_header();
 		}
 
-		void	destroy_dummy( void )
+		void	reset_header( void )
 		{
-			_bst_allocker.deallocate(_dummy_end, 1);
+			_header->parent = NULL;
+			_header->left = _header;
+			_header->right = _header;
+			_header->height = 0;
+		}
+
+		void	destroy_header( void )
+		{
+			_bst_allocker.deallocate(_header, 1);
+		}
+
+		BST_pointer	root( void ) const { return _header->parent; }
+
+		void	set_root( BST_pointer new_root )
+		{
+			_header->parent = new_root;
+			if (new_root)
+			{
+				new_root->parent = _header;
+				_header->left = new_root->find_start();
+				_header->right = new_root->find_end();
+			}
+			else
+				reset_header();
 		}
 
 	//KEEP ME TO PROVE THAT BINARY TREE TO CORRECTEUR
 	public:
-		BST_pointer getBST( void ) const {return _bst;};
+		BST_pointer getBST( void ) const {return root();};
 
 	public:
 		explicit map (const key_compare& comp = key_compare(),
-				const allocator_type& alloc = allocator_type()) : _compare(comp), _allocker(alloc), _size(0), _bst(NULL), _dummy_end(NULL) { init_dummy(); }
+				const allocator_type& alloc = allocator_type()) : _compare(comp), _allocker(alloc), _size(0), _bst_allocker(alloc), _header(NULL) { init_header(); }
 		
-		map (const map& x) : _compare(x._compare), _allocker(x._allocker), _size(x._size), _bst(NULL), _dummy_end(NULL) {
-			init_dummy();
-			if (x._bst)
-				_bst = x._bst->copy_this();
+		map (const map& x) : _compare(x._compare), _allocker(x._allocker), _size(x._size), _bst_allocker(x._allocker), _header(NULL) {
+			init_header();
+			if (x.root())
+				set_root(copy_tree(x.root(), _header, _bst_allocker));
 		 }
 
 		template <class InputIterator>
 		map (InputIterator first, InputIterator last,
 		const key_compare& comp = key_compare(),
-		const allocator_type& alloc = allocator_type()) :  _compare(comp), _allocker(alloc), _size(0), _bst(NULL), _dummy_end(NULL) { 
-			init_dummy();
+		const allocator_type& alloc = allocator_type()) :  _compare(comp), _allocker(alloc), _size(0), _bst_allocker(alloc), _header(NULL) { 
+			init_header();
 			insert(first, last);
 		}
 
-		~map( void ) { destroy_dummy(); destroy_bst(); }
+#if __cplusplus >= 201103L
+		//the moved-from map is left empty with a header of its own
+		map (map&& x) : _compare(x._compare), _allocker(x._allocker), _size(0), _bst_allocker(x._bst_allocker), _header(NULL) {
+			init_header();
+			swap(x);
+		}
+#endif
+
+		~map( void ) { destroy_bst(); destroy_header(); }
 
 		map&	operator=(const map& x) {
 			if (this != &x)
 			{
 				_compare = x._compare;
 				destroy_bst();
-				if (x._bst)
-					_bst = x._bst->copy_this();
+				if (x.root())
+					set_root(copy_tree(x.root(), _header, _bst_allocker));
 				_size = x._size;
-				_bst_allocker = x._bst_allocker;
 			}
 			return (*this);
 		}
 
+#if __cplusplus >= 201103L
+		map&	operator=(map&& x) {
+			if (this != &x)
+			{
+				map tmp(std::move(x));
+
+				swap(tmp);
+			}
+			return (*this);
+		}
+#endif
+
 	private:
 		void destroy_bst( void ) {
-			if (_bst)
+			if (root())
 			{
-				_bst_allocker.destroy(_bst);
-				_bst_allocker.deallocate(_bst, 1);
-				_bst = NULL;
+				destroy_tree(root(), _bst_allocker);
+				reset_header();
 				_size = 0;
 			}
 		};
@@ -120,276 +165,303 @@ class map
 	public:
 
 		ft::pair<iterator,bool> insert (const value_type& val){
-			ft::pair<BST_pointer, bool>	ret;
-			ft::pair<iterator, bool> 	convert;
-
-			if (!_bst)
-			{
-				_bst = _bst_allocker.allocate(1);
-				_bst_allocker.construct(_bst, val);
-				ret.first = _bst;
-				ret.second = true;
-			}
-			else
-			{
-				ret = _bst->insert(val);
-				balance(_bst);
-				_bst = rotate(_bst);
-				_bst->parent = NULL;
-			}
-			
-			if (ret.second)
+			if (!root())
 			{
-				convert.second = true;
-				convert.first = iterator(ret.first, _dummy_end, 0);
+				BST_pointer new_root = BST_type::create_node(_bst_allocker, val);
+				set_root(new_root);
 				_size++;
+				return (ft::make_pair(iterator(new_root), true));
 			}
-			else
+
+			ft::pair<BST_pointer, bool>	ret = root()->insert(val, _compare, _bst_allocker);
+
+			if (ret.second)
+				link_leaf(ret.first);
+			return (ft::make_pair(iterator(ret.first), ret.second));
+		}
+
+#if __cplusplus >= 201103L
+		//the key is looked up before anything is built or moved from
+		ft::pair<iterator,bool> insert (value_type&& val) {
+			return (emplace_unique(val.first, bst_emplace_tag(), std::move(val)));
+		}
+
+		//the node has to exist before its key can be compared
+		template <class... Args>
+		ft::pair<iterator,bool> emplace (Args&&... args) {
+			BST_pointer				node = BST_type::create_node(_bst_allocker, bst_emplace_tag(), std::forward<Args>(args)...);
+			BST_pointer				parent = NULL;
+			bool					on_left = false;
+
+			if (root())
 			{
-				convert.second = false;
-				convert.first = iterator(ret.first, _dummy_end, 0);
+				ft::pair<BST_pointer, bool>	slot = root()->find_leaf_slot(node->elem.first, _compare, on_left);
+
+				if (!slot.second)
+				{
+					destroy_pointer(node, _bst_allocker);
+					return (ft::make_pair(iterator(slot.first), false));
+				}
+				parent = slot.first;
 			}
-			return (convert);
+			link_node(node, parent, on_left);
+			return (ft::make_pair(iterator(node), true));
 		}
 
+		//args are left untouched when k is already there
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (const key_type& k, Args&&... args) {
+			return (emplace_unique(k, bst_try_emplace_tag(), k, std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (key_type&& k, Args&&... args) {
+			return (emplace_unique(k, bst_try_emplace_tag(), std::move(k), std::forward<Args>(args)...));
+		}
+#endif
+
 		template <class InputIterator>
   		void insert (InputIterator first, InputIterator last){
+			iterator hint = end();
+
+			if (!root() && build_sorted(first, last, typename std::iterator_traits<InputIterator>::iterator_category()))
+				return ;
+
 			for (; first != last; first++)
-				insert(*first);
+				hint = insert(hint, *first);
 		}
 
+		//same contract as std::map: val goes right before position when it fits
+		//there, otherwise we fall back on a descent from the root
 		iterator insert (iterator position, const value_type& val)
 		{
-			static_cast<void> (position);
-			ft::pair<iterator, bool> ret = insert(val);
-			return (ret.first);
-		}
+			BST_pointer hint = position.base();
 
-		void		erase( iterator position )
-		{	
-			if (!_bst)
-				return ;
-			else
+			if (!root())
+				return (insert(val).first);
+			if (hint == _header)
 			{
-				if (position.base() == _bst)
+				if (_compare(_header->right->elem.first, val.first))
+					return (insert_leaf(_header->right, false, val));
+			}
+			else if (_compare(val.first, hint->elem.first))
+			{
+				if (hint == _header->left)
+					return (insert_leaf(hint, true, val));
+				BST_pointer before = predecessor(hint);
+				if (_compare(before->elem.first, val.first))
 				{
-					_bst = destroy(_bst);
-					if (_bst)
-					{
-						balance(_bst);
-						_bst = rotate(_bst);
-						_bst->parent = NULL;
-					}
-					_size--;
-					return ;
+					if (!before->right)
+						return (insert_leaf(before, false, val));
+					return (insert_leaf(hint, true, val));
 				}
-				else
+			}
+			else if (_compare(hint->elem.first, val.first))
+			{
+				if (hint == _header->right)
+					return (insert_leaf(hint, false, val));
+				BST_pointer after = successor(hint);
+				if (_compare(val.first, after->elem.first))
 				{
-					BST_pointer d_stroy = position.base();
-					BST_pointer parent = d_stroy->parent;
-					BST_pointer parent2 = parent->parent;
-
-					if (parent->left == d_stroy)
-						parent->left = destroy(d_stroy);
-					else
-						parent->right = destroy(d_stroy);
-					balance(parent);
-					while (parent2 != NULL)
-					{
-						if (parent2->left == parent)
-							parent2->left = rotate(parent);
-						else
-							parent2->right = rotate(parent);
-						balance(parent2);
-						parent = parent2;
-						parent2 = parent2->parent;
-					}
-					balance(_bst);
-					_bst = rotate(_bst);
-					_bst->parent = NULL;
-					_bst->recursive_balancing();
-					_size--;
-					return ;
+					if (!hint->right)
+						return (insert_leaf(hint, false, val));
+					return (insert_leaf(after, true, val));
 				}
 			}
+			else
+				return (position);
+			return (insert(val).first);
 		}
 
-		void		erase(iterator first, iterator last)
+	private:
+		template <class InputIterator>
+		bool	build_sorted( InputIterator, InputIterator, std::input_iterator_tag ) { return false; }
+
+		//sorted unique input is laid out directly as a perfectly balanced tree:
+		//one pass to check the order, one pass to build, no descent or rotation
+		template <class ForwardIterator>
+		bool	build_sorted( ForwardIterator first, ForwardIterator last, std::forward_iterator_tag )
 		{
-			while (first != last)
-				erase(first++);
+			size_type		n = 0;
+			ForwardIterator	prev = first;
+
+			for (ForwardIterator it = first; it != last; it++, n++)
+			{
+				if (n && !_compare((*prev).first, (*it).first))
+					return false;
+				prev = it;
+			}
+			set_root(build_sorted_subtree(first, n, _header));
+			_size = n;
+			return true;
 		}
 
-		size_type	erase(const key_type & k)
+		template <class ForwardIterator>
+		BST_pointer	build_sorted_subtree( ForwardIterator & first, size_type n, BST_pointer parent )
 		{
-			if (!_bst)
-				return 0;
-			if (_bst->elem.first == k)
+			if (n == 0)
+				return NULL;
+
+			BST_pointer	left = build_sorted_subtree(first, (n - 1) / 2, NULL);
+			BST_pointer	node = _bst_allocker.allocate(1);
+
+			_bst_allocker.construct(node, value_type(*first));
+			first++;
+			node->parent = parent;
+			node->left = left;
+			if (left)
+				left->parent = node;
+			node->right = build_sorted_subtree(first, n - 1 - (n - 1) / 2, node);
+			balance(node);
+			return node;
+		}
+
+		iterator	insert_leaf( BST_pointer parent, bool on_left, const value_type& val )
+		{
+			BST_pointer leaf = parent->insert_leaf(val, on_left, _bst_allocker);
+
+			link_leaf(leaf);
+			return (iterator(leaf));
+		}
+
+#if __cplusplus >= 201103L
+		template <class... Args>
+		ft::pair<iterator,bool>	emplace_unique( const key_type& k, Args&&... args )
+		{
+			BST_pointer	parent = NULL;
+			bool		on_left = false;
+
+			if (root())
 			{
-				_bst = destroy(_bst);
-				if (_bst)
-				{
-					balance(_bst);
-					_bst = rotate(_bst);
-					_bst->parent = NULL;
-				}
-				_size--;
-				return 1;
+				ft::pair<BST_pointer, bool>	slot = root()->find_leaf_slot(k, _compare, on_left);
+
+				if (!slot.second)
+					return (ft::make_pair(iterator(slot.first), false));
+				parent = slot.first;
 			}
-			if (_bst->erase_elem(k))
+
+			BST_pointer	node = BST_type::create_node(_bst_allocker, std::forward<Args>(args)...);
+
+			link_node(node, parent, on_left);
+			return (ft::make_pair(iterator(node), true));
+		}
+
+		//parent is NULL for the first node of an empty tree
+		void	link_node( BST_pointer node, BST_pointer parent, bool on_left )
+		{
+			if (!parent)
 			{
-				balance(_bst);
-				_bst = rotate(_bst);
-				_bst->parent = NULL;
-				_size--;
-				return 1;
+				set_root(node);
+				_size++;
+				return ;
 			}
-			else
-				return 0;
+			parent->attach_leaf(node, on_left);
+			link_leaf(node);
 		}
+#endif
 
-	//ITERATORS//
-	public:
-		iterator begin( void ) {
-			if (_bst)
-				return (iterator(_bst->find_start(), _dummy_end, 0));
-			else
-				return (iterator(_dummy_end, _dummy_end, 1));
+		//keep leftmost / rightmost up to date, then rebalance above the new leaf
+		void	link_leaf( BST_pointer leaf )
+		{
+			BST_pointer parent = leaf->parent;
+
+			if (parent == _header->left && parent->left == leaf)
+				_header->left = leaf;
+			else if (parent == _header->right && parent->right == leaf)
+				_header->right = leaf;
+			rebalance_up(parent, _header);
+			_size++;
 		}
 
-		const_iterator begin() const {
-			if (_bst)
-				return (const_iterator(_bst->find_start(), _dummy_end, 0));
-			else
-				return (const_iterator(_dummy_end, _dummy_end, 1));
-		};
-
+	public:
+		void		erase( iterator position )
+		{	
+			if (!root())
+				return ;
+			destroy(position.base(), _header, _bst_allocker);
+			_size--;
+		}
 
-		iterator end( void ){
-			if (_bst)
-				return (iterator(_bst->find_end(), _dummy_end, 1));
-			else
-				return (iterator(_dummy_end, _dummy_end, 1));
+		void		erase(iterator first, iterator last)
+		{
+			while (first != last)
+				erase(first++);
 		}
 
-		const_iterator end( void ) const {
-			if (_bst)
-				return (const_iterator(_bst->find_end(), _dummy_end, 1));
-			else
-				return (const_iterator(_dummy_end, _dummy_end, 1));
+		size_type	erase(const key_type & k)
+		{
+			if (!root())
+				return 0;
+			BST_pointer d_stroy = root()->find_by_key(k, _compare);
+			if (!d_stroy)
+				return 0;
+			destroy(d_stroy, _header, _bst_allocker);
+			_size--;
+			return 1;
 		}
 
+	//ITERATORS//
+	public:
+		iterator		begin( void ) { return (iterator(_header->left)); }
+		const_iterator	begin( void ) const { return (const_iterator(_header->left)); }
+		iterator		end( void ) { return (iterator(_header)); }
+		const_iterator	end( void ) const { return (const_iterator(_header)); }
+
 		iterator find (const key_type& k){
-			if (_bst)
-			{
-				BST_pointer tmp = _bst->find_by_key(k);
-				if (tmp)
-					return (iterator(tmp, _dummy_end, 0));
-				else
-					return (end());
-			}
+			BST_pointer tmp = (root() ? root()->find_by_key(k, _compare) : NULL);
+			if (tmp)
+				return (iterator(tmp));
 			else
-				return (iterator(_dummy_end, _dummy_end, 1));	
+				return (end());
 		}
 
 		const_iterator find (const key_type& k) const{
-			if (_bst)
-			{
-				BST_pointer tmp = _bst->find_by_key(k);
-				if (tmp)
-					return (const_iterator(tmp, _dummy_end, 0));
-				else
-					return (end());
-			}
+			BST_pointer tmp = (root() ? root()->find_by_key(k, _compare) : NULL);
+			if (tmp)
+				return (const_iterator(tmp));
 			else
-				return (const_iterator(_dummy_end, _dummy_end, 1));
+				return (end());
 		}
 
 		size_type	count( const key_type& k) const{
-			if (_bst)
-			{
-				BST_pointer tmp = _bst->find_by_key(k);
-				if (tmp)
-					return 1;
-				else
-					return 0;
-			}
+			if (root() && root()->find_by_key(k, _compare))
+				return 1;
 			else
 				return 0;
 		}
 
 		iterator lower_bound (const key_type& k)
 		{
-			if (_bst)
-			{
-				iterator it = begin();
-				iterator it_end = end();
-				for (; it != it_end; it++)
-				{
-					if (!_compare(it->first, k))
-						break;
-				}
-				return (it);
-			}
+			BST_pointer tmp = (root() ? root()->lower_bound(k, _compare) : NULL);
+			if (tmp)
+				return (iterator(tmp));
 			else
-				return (iterator(_dummy_end, _dummy_end, 1));
+				return (end());
 		}
 
 		const_iterator lower_bound (const key_type& k) const
 		{
-			if (_bst)
-			{
-				const_iterator it = begin();
-				const_iterator it_end = end();
-				for (; it != it_end; it++)
-				{
-					if (!_compare(it->first, k))
-						break;
-				}
-				return (it);
-			}
+			BST_pointer tmp = (root() ? root()->lower_bound(k, _compare) : NULL);
+			if (tmp)
+				return (const_iterator(tmp));
 			else
-				return (const_iterator(_dummy_end, _dummy_end, 1));
+				return (end());
 		}
 	
 		iterator upper_bound (const key_type& k){
-			if (_bst)
-			{
-				iterator it = begin();
-				iterator it_end = end();
-				for (; it != it_end; it++)
-				{
-					if (!_compare(it->first, k))
-					{
-						if (it->first == k)
-							it++;
-						break;
-					}
-				}
-				return (it);
-			}
+			BST_pointer tmp = (root() ? root()->upper_bound(k, _compare) : NULL);
+			if (tmp)
+				return (iterator(tmp));
 			else
-				return (iterator(_dummy_end, _dummy_end, 1));
+				return (end());
 		}
 
 		const_iterator upper_bound (const key_type& k) const{
-			if (_bst)
-			{
-				const_iterator it = begin();
-				const_iterator it_end = end();
-				for (; it != it_end; it++)
-				{
-					if (!_compare(it->first, k))
-					{
-						if (it->first == k)
-							it++;
-						break;
-					}
-				}
-				return (it);
-			}
+			BST_pointer tmp = (root() ? root()->upper_bound(k, _compare) : NULL);
+			if (tmp)
+				return (const_iterator(tmp));
 			else
-				return (const_iterator(_dummy_end, _dummy_end, 1));
+				return (end());
 		}
 
 		ft::pair<iterator,iterator>             equal_range (const key_type& k){
@@ -400,6 +472,48 @@ class map
 			return (ft::make_pair(lower_bound(k), upper_bound(k)));
 		}
 
+	//ORDER STATISTICS//
+	//every node knows the weight of its subtree: one descent, no scan
+	public:
+		//k-th element in key order, from 0. end() when k >= size()
+		iterator nth (size_type k){
+			BST_pointer tmp = select_node(root(), k);
+			if (tmp)
+				return (iterator(tmp));
+			else
+				return (end());
+		}
+
+		const_iterator nth (size_type k) const{
+			BST_pointer tmp = select_node(root(), k);
+			if (tmp)
+				return (const_iterator(tmp));
+			else
+				return (end());
+		}
+
+		//number of keys less than k, the index lower_bound(k) is at
+		size_type	rank (const key_type& k) const{
+			if (root())
+				return (root()->count_less(k, _compare));
+			return 0;
+		}
+
+		//number of keys in [lo, hi)
+		size_type	count_range (const key_type& lo, const key_type& hi) const{
+			if (!_compare(lo, hi))
+				return 0;
+			return (rank(hi) - rank(lo));
+		}
+
+		//index of position in key order, size() for end(). The distance
+		//between two iterators is the difference of their indexes
+		size_type	index_of (const_iterator position) const{
+			if (position == end())
+				return (_size);
+			return (node_rank(position.base()));
+		}
+
 		reverse_iterator rbegin( void ) {
 			return reverse_iterator(end()); 
 		};
@@ -414,13 +528,31 @@ class map
 			return const_reverse_iterator(begin()); 
 		};
 
+#if __cplusplus >= 201103L
+		mapped_type& operator[] (const key_type& k)
+		{
+			return (*(try_emplace(k).first)).second;
+		}
+
+		mapped_type& operator[] (key_type&& k)
+		{
+			return (*(try_emplace(std::move(k)).first)).second;
+		}
+#else
 		mapped_type& operator[] (const key_type& k)
 		{
 			return (*((this->insert(ft::make_pair(k, mapped_type()))).first)).second;
 		}
+#endif
 
 	public:
-		void 			clear() { destroy_bst(); };
+		//a fresh header lets a pooling allocator see every node come back
+		//and hand all but one of its slabs back to the system
+		void 			clear() {
+			destroy_bst();
+			destroy_header();
+			init_header();
+		};
 		size_type		size( void ) const { return _size; }
 		size_type		max_size() const { return _bst_allocker.max_size(); }
 		bool			empty( void ) const { return (_size == 0 ? true : false); }
@@ -428,16 +560,15 @@ class map
 		key_compare		key_comp() const { return _compare; }
 		void			swap (map& x) { 
 			size_type 		tmp_size = _size;
-			BST_pointer 	tmp_bst = _bst;
-			BST_pointer		tmp_dummy = _dummy_end;
+			BST_pointer		tmp_header = _header;
 
 			_size = x._size;
-			_bst = x._bst;
-			_dummy_end = x._dummy_end;
+			_header = x._header;
 
 			x._size = tmp_size;
-			x._bst = tmp_bst;
-			x._dummy_end = tmp_dummy;
+			x._header = tmp_header;
+			std::swap(_compare, x._compare);
+			std::swap(_bst_allocker, x._bst_allocker);
 		};
 		value_compare 	value_comp() const { return value_compare(_compare); };
 };
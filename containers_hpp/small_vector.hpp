@@ -0,0 +1,448 @@
+#ifndef __SMALL_VECTOR_HPP__
+# define __SMALL_VECTOR_HPP__
+
+# include "containers.hpp"
+# include "iterators/iterator.hpp"
+# include "utils/traits.hpp"
+# include "utils/utils.hpp"
+# include "utils/relocate.hpp"
+
+namespace ft{
+
+//same interface as ft::vector, but the first N elements live inside the
+//object itself: nothing is allocated until the N + 1th element comes in.
+//once spilled to the heap we stay there, like ft::vector never shrinks
+template < typename T, std::size_t N, typename A = std::allocator<T> >
+class small_vector{
+
+	public:
+		typedef T 																		value_type;
+		typedef A																		allocator_type;
+		typedef typename A::size_type													size_type;
+		typedef	typename A::difference_type												difference_type;
+		typedef typename A::pointer														pointer;
+		typedef typename A::const_pointer												const_pointer;
+		typedef typename A::reference													reference;
+		typedef typename A::const_reference												const_reference;
+		typedef typename ft::RandomAccessIterator< ft::small_vector<T, N, A>, false >	iterator;
+		typedef	typename ft::RandomAccessIterator< const ft::small_vector<T, N, A>, true >	const_iterator;
+		typedef typename ft::reverse_iterator< iterator >								reverse_iterator;
+		typedef typename ft::reverse_iterator< const_iterator >							const_reverse_iterator;
+
+	public:
+		explicit small_vector( const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _size(0), _capacity(N), _vector(_inline_buffer()) {}
+
+		explicit small_vector( size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _size(0), _capacity(N), _vector(_inline_buffer())
+		{
+			assign(n, val);
+		}
+
+		template <class InputIterator>
+		small_vector( InputIterator first, InputIterator last,
+				const allocator_type& alloc = allocator_type(), typename enable_if< !is_integral<InputIterator>::value >::type* = 0 ) : _allocker(alloc), _size(0), _capacity(N), _vector(_inline_buffer())
+		{
+			assign(first, last);
+		}
+
+		small_vector( const small_vector & x ) : _allocker(x._allocker), _size(0), _capacity(N), _vector(_inline_buffer())
+		{
+			*this = x;
+		}
+
+#if __cplusplus >= 201103L
+		small_vector( small_vector && x ) : _allocker(x._allocker), _size(0), _capacity(N), _vector(_inline_buffer())
+		{
+			_steal(x);
+		}
+#endif
+
+		~small_vector( void ) { _destroy_vector(); }
+
+		small_vector &	operator=( const small_vector & x )
+		{
+			if (this != &x)
+			{
+				clear();
+				reserve(x._size);
+				for (; _size != x._size; _size++)
+					_allocker.construct(&_vector[_size], x._vector[_size]);
+			}
+			return (*this);
+		}
+
+#if __cplusplus >= 201103L
+		small_vector &	operator=( small_vector && x )
+		{
+			if (this != &x)
+			{
+				_destroy_vector();
+				_steal(x);
+			}
+			return (*this);
+		}
+#endif
+
+	//MODIFIERS
+	public:
+		iterator insert( iterator position, const value_type& val )
+		{
+			size_type	offset = position - begin();
+
+			insert(position, 1, val);
+			return (begin() + offset);
+		}
+
+		void insert( iterator position, size_type n, const value_type& val )
+		{
+			if (n == 0)
+				return ;
+
+			//val may be an element the gap is about to move
+			value_type	copy(val);
+			pointer		pos = _open_gap(position - begin(), n);
+
+			for (size_type i = 0; i != n; i++)
+				_allocker.construct(&pos[i], copy);
+			_size += n;
+		}
+
+		template <class InputIterator>
+		void insert( iterator position, InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			_range_insert(position, first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+		}
+
+#if __cplusplus >= 201103L
+		iterator insert( iterator position, value_type&& val )
+		{
+			size_type	offset = position - begin();
+
+			_allocker.construct(_open_gap(offset, 1), std::move(val));
+			_size++;
+			return (begin() + offset);
+		}
+
+		template <class... Args>
+		iterator emplace( iterator position, Args&&... args )
+		{
+			if (position == end())
+			{
+				emplace_back(std::forward<Args>(args)...);
+				return (end() - 1);
+			}
+			return (insert(position, value_type(std::forward<Args>(args)...)));
+		}
+#endif
+
+		iterator erase( iterator position ) { return (erase(position, position + 1)); }
+
+		iterator erase( iterator first, iterator last )
+		{
+			size_type	offset = first - begin();
+			size_type	count = last - first;
+
+			for (size_type i = offset; i != offset + count; i++)
+				_allocker.destroy(&_vector[i]);
+			ft::relocate(_allocker, _vector + offset, _vector + offset + count, _size - offset - count);
+			_size -= count;
+			return (begin() + offset);
+		}
+
+		template <class InputIterator>
+		void assign( InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			clear();
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		//val may be one of our elements, clear() would destroy it
+		void assign( size_type n, const value_type& val )
+		{
+			value_type	copy(val);
+
+			clear();
+			reserve(n);
+			for (; _size != n; _size++)
+				_allocker.construct(&_vector[_size], copy);
+		}
+
+#if __cplusplus >= 201103L
+		void	push_back( const value_type & val ) { emplace_back(val); }
+		void	push_back( value_type && val ) { emplace_back(std::move(val)); }
+
+		template <class... Args>
+		void	emplace_back( Args&&... args )
+		{
+			if (_size == _capacity)
+			{
+				size_type	new_capacity = std::max(_size + 1, _capacity * 2);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				_allocker.construct(&new_vec[_size], std::forward<Args>(args)...);
+				_adopt(new_vec, new_capacity);
+			}
+			else
+				_allocker.construct(&_vector[_size], std::forward<Args>(args)...);
+			_size++;
+		}
+#else
+		//val may be an element of the vector: it is copied to the new
+		//buffer before the old one goes away
+		void	push_back( const value_type & val )
+		{
+			if (_size == _capacity)
+			{
+				size_type	new_capacity = std::max(_size + 1, _capacity * 2);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				_allocker.construct(&new_vec[_size], val);
+				_adopt(new_vec, new_capacity);
+			}
+			else
+				_allocker.construct(&_vector[_size], val);
+			_size++;
+		}
+#endif
+
+		void	pop_back( void )
+		{
+			if (_size == 0)
+				return ;
+			_allocker.destroy(&_vector[--_size]);
+		}
+
+		void	reserve( size_type n )
+		{
+			if (n > max_size())
+				throw std::length_error("small_vector::reserve");
+			if (n > _capacity)
+				_adopt(_allocker.allocate(n), n);
+		}
+
+		void	resize( size_type n, value_type val = value_type() )
+		{
+			if (n > _capacity)
+				reserve(std::max(n, _capacity * 2));
+			while (_size > n)
+				_allocker.destroy(&_vector[--_size]);
+			for (; _size < n; _size++)
+				_allocker.construct(&_vector[_size], val);
+		}
+
+		void	clear( void )
+		{
+			while (_size)
+				_allocker.destroy(&_vector[--_size]);
+		}
+
+		//two heap buffers trade pointers, inline elements have to be moved
+		void	swap( small_vector & x )
+		{
+			if (this == &x)
+				return ;
+			if (!_is_inline() && !x._is_inline())
+			{
+				std::swap(_vector, x._vector);
+				std::swap(_size, x._size);
+				std::swap(_capacity, x._capacity);
+				return ;
+			}
+
+			small_vector	tmp(_allocker);
+
+			tmp._steal(x);
+			x._steal(*this);
+			_steal(tmp);
+		}
+
+	//ITERATORS
+	public:
+		iterator				begin( void ) { return (iterator(_vector)); }
+		iterator				end( void ) { return (iterator(_vector + _size)); }
+		const_iterator			begin( void ) const { return (const_iterator(_vector)); }
+		const_iterator			end( void ) const { return (const_iterator(_vector + _size)); }
+		reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+		reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+		const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+		const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	//ACCESS
+	public:
+		reference		operator[]( size_type n ) { return _vector[n]; }
+		const_reference	operator[]( size_type n ) const { return _vector[n]; }
+		reference		front( void ) { return _vector[0]; }
+		const_reference	front( void ) const { return _vector[0]; }
+		reference		back( void ) { return _vector[_size - 1]; }
+		const_reference	back( void ) const { return _vector[_size - 1]; }
+		pointer			data( void ) { return _vector; }
+		const_pointer	data( void ) const { return _vector; }
+		reference		at( size_type n )
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::small_vector::at");
+			return (_vector[n]);
+		}
+		const_reference	at( size_type n ) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::small_vector::at");
+			return (_vector[n]);
+		}
+		size_type		capacity( void ) const { return _capacity; }
+		size_type		size( void ) const { return _size; }
+		bool			empty( void ) const { return (_size == 0); }
+		size_type		max_size( void ) const { return _allocker.max_size(); }
+		allocator_type	get_allocator( void ) const { return _allocker; }
+		bool			is_inline( void ) const { return _is_inline(); }
+
+	private:
+		pointer	_inline_buffer( void ) { return (reinterpret_cast<pointer>(_inline.bytes)); }
+		bool	_is_inline( void ) const { return (_vector == reinterpret_cast<const_pointer>(_inline.bytes)); }
+
+		void	_destroy_vector( void )
+		{
+			clear();
+			if (!_is_inline())
+				_allocker.deallocate(_vector, _capacity);
+			_vector = _inline_buffer();
+			_capacity = N;
+		}
+
+		//relocates the elements into new_vec, which becomes our buffer
+		void	_adopt( pointer new_vec, size_type new_capacity )
+		{
+			ft::relocate(_allocker, new_vec, _vector, _size);
+			if (!_is_inline())
+				_allocker.deallocate(_vector, _capacity);
+			_capacity = new_capacity;
+			_vector = new_vec;
+		}
+
+		//makes room for n raw slots at offset and returns the first one
+		pointer	_open_gap( size_type offset, size_type n )
+		{
+			if (_size + n > _capacity)
+			{
+				size_type	new_capacity = std::max(_size + n, _capacity * 2);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				ft::relocate(_allocker, new_vec, _vector, offset);
+				ft::relocate(_allocker, new_vec + offset + n, _vector + offset, _size - offset);
+				if (!_is_inline())
+					_allocker.deallocate(_vector, _capacity);
+				_capacity = new_capacity;
+				_vector = new_vec;
+			}
+			else
+				ft::relocate(_allocker, _vector + offset + n, _vector + offset, _size - offset);
+			return (_vector + offset);
+		}
+
+		template <class InputIterator>
+		void	_range_insert( iterator position, InputIterator first, InputIterator last, std::input_iterator_tag )
+		{
+			for (; first != last; first++)
+			{
+				position = insert(position, *first);
+				position++;
+			}
+		}
+
+		template <class ForwardIterator>
+		void	_range_insert( iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag )
+		{
+			size_type	n = std::distance(first, last);
+			pointer		pos = _open_gap(position - begin(), n);
+
+			for (; first != last; first++, pos++)
+				_allocker.construct(pos, *first);
+			_size += n;
+		}
+
+		//takes everything x holds, x is left empty and inline.
+		//we have to be empty and inline ourselves
+		void	_steal( small_vector & x )
+		{
+			if (x._is_inline())
+				ft::relocate(_allocker, _vector, x._vector, x._size);
+			else
+			{
+				_vector = x._vector;
+				_capacity = x._capacity;
+				x._vector = x._inline_buffer();
+				x._capacity = N;
+			}
+			_size = x._size;
+			x._size = 0;
+		}
+
+	private:
+		//raw bytes for N elements, the other members only force the alignment
+#if __cplusplus >= 201103L
+		struct inline_storage
+		{
+			alignas(T) char	bytes[(N ? N : 1) * sizeof(T)];
+		};
+#else
+		union inline_storage
+		{
+			char		bytes[(N ? N : 1) * sizeof(T)];
+			long double	align_ld;
+			long		align_l;
+			void		*align_ptr;
+		};
+#endif
+
+		allocator_type	_allocker;
+		size_type		_size;
+		size_type		_capacity;
+		pointer			_vector;
+		inline_storage	_inline;
+};
+
+//NON-MEMBER
+template <class T, std::size_t N, class Alloc>
+void swap( ft::small_vector<T,N,Alloc>& x, ft::small_vector<T,N,Alloc>& y )
+{
+	x.swap(y);
+}
+
+template <class T, std::size_t N, class Alloc, class Predicate>
+typename ft::small_vector<T,N,Alloc>::size_type erase_if( ft::small_vector<T,N,Alloc>& c, Predicate pred )
+{
+	typename ft::small_vector<T,N,Alloc>::iterator	it = ft::remove_if(c.begin(), c.end(), pred);
+	typename ft::small_vector<T,N,Alloc>::size_type	count = c.end() - it;
+
+	c.erase(it, c.end());
+	return (count);
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator==( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs )
+{
+	return (lhs.size() == rhs.size() && ft::contiguous_equal(lhs.data(), rhs.data(), lhs.size()));
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator!=( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs ) { return (!(lhs == rhs)); }
+
+template <class T, std::size_t N, class Alloc>
+bool operator<( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs )
+{
+	return (ft::contiguous_less(lhs.data(), lhs.size(), rhs.data(), rhs.size()));
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator>( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs ) { return (rhs < lhs); }
+
+template <class T, std::size_t N, class Alloc>
+bool operator<=( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs ) { return (!(rhs < lhs)); }
+
+template <class T, std::size_t N, class Alloc>
+bool operator>=( const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs ) { return (!(lhs < rhs)); }
+
+}
+
+#endif
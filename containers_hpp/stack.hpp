@@ -1,11 +1,12 @@
 #ifndef __STACK_HPP__
 # define __STACK_HPP__
 
-#include "vector.hpp"
+#include "deque.hpp"
 
 namespace ft{
 
-template< typename T, class Container=ft::vector<T> >
+//deque by default as std does: growing never copies what is already stacked
+template< typename T, class Container=ft::deque<T> >
 class stack{
 	public:
 		typedef Container								container_type;
@@ -26,12 +27,25 @@ class stack{
 				this->c = rhs.c;
 			return *this;
 		}
+#if __cplusplus >= 201103L
+		explicit stack( container_type&& ctnr ) : c(std::move(ctnr)) {}
+		stack(stack && src) : c(std::move(src.c)) {}
+		stack & operator=(stack && rhs) {
+			c = std::move(rhs.c);
+			return *this;
+		}
+#endif
 	
 		bool				empty( void ) const { return c.empty(); }
 		size_type			size( void ) const { return c.size(); }
      	reference	 		top( void ){ return c.back(); }
 		const_reference		top( void ) const{ return c.back(); }
 		void				push( const value_type& val) { c.push_back(val); }
+#if __cplusplus >= 201103L
+		void				push( value_type&& val) { c.push_back(std::move(val)); }
+		template <class... Args>
+		void				emplace( Args&&... args ) { c.emplace_back(std::forward<Args>(args)...); }
+#endif
 		void				pop( void ) { c.pop_back(); }
 
 	public:
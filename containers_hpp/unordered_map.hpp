@@ -0,0 +1,593 @@
+#ifndef __UNORDERED_MAP_HPP__
+# define __UNORDERED_MAP_HPP__
+
+# include "containers.hpp"
+# include "utils/utils.hpp"
+# include "utils/hash.hpp"
+# include "utils/ctrl_group.hpp"
+# include "utils/relocate.hpp"
+# include "iterators/hash_iterator.hpp"
+
+namespace ft{
+
+//open addressing, SwissTable style. Slots live in one array and a parallel
+//array of control bytes holds the low 7 bits of each hash (h2). The high
+//bits (h1) pick where probing starts, then 16 control bytes are compared
+//to h2 at once and only matching slots compare their keys. A group with an
+//empty byte ends the probe. Elements never move but on rehash, so insert
+//and erase only invalidate iterators when they rehash.
+//The capacity is 2^k - 1: its control bytes are followed by a sentinel for
+//the iterators, then by a copy of the first 15 so any group can be read at
+//once. Hash must spread its bits over the whole size_t, as ft::hash does
+template < class Key,
+			class T,
+			class Hash = ft::hash< Key >,
+			class Pred = ft::equal_to< Key >,
+			class Alloc = std::allocator< ft::pair<const Key,T> >
+			>
+class unordered_map
+{
+	public:
+		typedef Key																		key_type;
+		typedef T																		mapped_type;
+		typedef ft::pair< const Key, T >												value_type;
+		typedef Hash																	hasher;
+		typedef Pred																	key_equal;
+		typedef Alloc																	allocator_type;
+		typedef typename allocator_type::size_type										size_type;
+		typedef typename allocator_type::difference_type								difference_type;
+		typedef typename allocator_type::reference										reference;
+		typedef typename allocator_type::const_reference								const_reference;
+		typedef typename allocator_type::pointer										pointer;
+		typedef typename allocator_type::const_pointer									const_pointer;
+		typedef ft::hash_iterator< value_type, false >									iterator;
+		typedef ft::hash_iterator< value_type, true >									const_iterator;
+
+	private:
+		typedef typename Alloc::template rebind< ctrl_t >::other						ctrl_allocator_type;
+
+		hasher					_hash;
+		key_equal				_equal;
+		allocator_type			_allocker;
+		ctrl_allocator_type		_ctrl_allocker;
+		ctrl_t					*_ctrl;
+		pointer					_slots;
+		size_type				_capacity;
+		size_type				_size;
+		//inserts left before a rehash, slots turned into tombstones count
+		size_type				_growth_left;
+		float					_max_load_factor;
+
+	public:
+		explicit unordered_map (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+				const allocator_type& alloc = allocator_type()) : _hash(hf), _equal(eql), _allocker(alloc), _ctrl_allocker(alloc),
+				_ctrl(empty_ctrl_group()), _slots(NULL), _capacity(0), _size(0), _growth_left(0), _max_load_factor(0.875f) {
+			if (n)
+				resize(normalize_capacity(n));
+		}
+
+		template <class InputIterator>
+		unordered_map (InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+				const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type()) : _hash(hf), _equal(eql),
+				_allocker(alloc), _ctrl_allocker(alloc), _ctrl(empty_ctrl_group()), _slots(NULL), _capacity(0), _size(0), _growth_left(0), _max_load_factor(0.875f) {
+			if (n)
+				resize(normalize_capacity(n));
+			insert(first, last);
+		}
+
+		unordered_map (const unordered_map& x) : _hash(x._hash), _equal(x._equal), _allocker(x._allocker), _ctrl_allocker(x._ctrl_allocker),
+				_ctrl(empty_ctrl_group()), _slots(NULL), _capacity(0), _size(0), _growth_left(0), _max_load_factor(x._max_load_factor) {
+			copy_table(x);
+		}
+
+#if __cplusplus >= 201103L
+		unordered_map (unordered_map&& x) : _hash(x._hash), _equal(x._equal), _allocker(x._allocker), _ctrl_allocker(x._ctrl_allocker),
+				_ctrl(empty_ctrl_group()), _slots(NULL), _capacity(0), _size(0), _growth_left(0), _max_load_factor(x._max_load_factor) {
+			swap(x);
+		}
+#endif
+
+		~unordered_map( void ) { destroy_table(); }
+
+		unordered_map&	operator=(const unordered_map& x) {
+			if (this != &x)
+			{
+				destroy_table();
+				_hash = x._hash;
+				_equal = x._equal;
+				_max_load_factor = x._max_load_factor;
+				copy_table(x);
+			}
+			return (*this);
+		}
+
+#if __cplusplus >= 201103L
+		unordered_map&	operator=(unordered_map&& x) {
+			if (this != &x)
+			{
+				unordered_map tmp(std::move(x));
+
+				swap(tmp);
+			}
+			return (*this);
+		}
+#endif
+
+	private:
+		static size_type	h1( size_type hash ) { return (hash >> 7); }
+		static ctrl_t		h2( size_type hash ) { return (static_cast<ctrl_t>(hash & 0x7F)); }
+
+		//slot i and, for the first 15, its copy past the sentinel
+		void	set_ctrl( size_type i, ctrl_t c )
+		{
+			_ctrl[i] = c;
+			_ctrl[((i - (ctrl_group::width - 1)) & _capacity) + (ctrl_group::width - 1)] = c;
+		}
+
+		//one slot is always left empty so that every probe ends
+		size_type	max_elements( size_type capacity ) const
+		{
+			size_type	n = static_cast<size_type>(capacity * static_cast<double>(_max_load_factor));
+
+			if (capacity == 0)
+				return 0;
+			if (n >= capacity)
+				return (capacity - 1);
+			return (n ? n : 1);
+		}
+
+		//smallest capacity 2^k - 1 holding n elements under the load factor
+		size_type	normalize_capacity( size_type n ) const
+		{
+			size_type	capacity = ctrl_group::width - 1;
+
+			while (max_elements(capacity) < n)
+				capacity = capacity * 2 + 1;
+			return (capacity);
+		}
+
+		//index of k, _capacity when it is not there
+		size_type	find_index( const key_type& k, size_type hash ) const
+		{
+			size_type	pos = h1(hash) & _capacity;
+			size_type	step = 0;
+
+			for (;;)
+			{
+				ctrl_group	group(_ctrl + pos);
+
+				for (group_mask m = group.match(h2(hash)); m; m &= m - 1)
+				{
+					size_type	i = (pos + group_mask_ctz(m)) & _capacity;
+
+					if (_equal(_slots[i].first, k))
+						return (i);
+				}
+				if (group.match_empty())
+					return (_capacity);
+				step += ctrl_group::width;
+				pos = (pos + step) & _capacity;
+			}
+		}
+
+		//first empty or deleted slot on the probe sequence of hash
+		size_type	find_free_slot( size_type hash ) const
+		{
+			size_type	pos = h1(hash) & _capacity;
+			size_type	step = 0;
+
+			for (;;)
+			{
+				group_mask	m = ctrl_group(_ctrl + pos).match_empty_or_deleted();
+
+				if (m)
+					return ((pos + group_mask_ctz(m)) & _capacity);
+				step += ctrl_group::width;
+				pos = (pos + step) & _capacity;
+			}
+		}
+
+		//where a new element of this hash goes, rehashing first when the
+		//slot is empty and no growth is left. A tombstone is reused as is
+		size_type	prepare_insert( size_type hash )
+		{
+			size_type	i = find_free_slot(hash);
+
+			if (_growth_left == 0 && _ctrl[i] != ctrl_deleted)
+			{
+				//mostly tombstones: clean them up in a table of the same size
+				if (_capacity && _size * 2 <= max_elements(_capacity))
+					resize(_capacity);
+				else
+					resize(_capacity ? _capacity * 2 + 1 : normalize_capacity(1));
+				i = find_free_slot(hash);
+			}
+			return (i);
+		}
+
+		//slot i has just been built
+		void	occupy( size_type i, size_type hash )
+		{
+			if (_ctrl[i] == ctrl_empty)
+				_growth_left--;
+			set_ctrl(i, h2(hash));
+			_size++;
+		}
+
+		ctrl_t *	allocate_ctrl( size_type capacity )
+		{
+			ctrl_t	*ctrl = _ctrl_allocker.allocate(capacity + ctrl_group::width);
+
+			std::memset(ctrl, ctrl_empty, capacity + ctrl_group::width);
+			ctrl[capacity] = ctrl_sentinel;
+			return (ctrl);
+		}
+
+		//every element is hashed again and relocated to the new arrays
+		void	resize( size_type new_capacity )
+		{
+			ctrl_t		*old_ctrl = _ctrl;
+			pointer		old_slots = _slots;
+			size_type	old_capacity = _capacity;
+
+			_ctrl = allocate_ctrl(new_capacity);
+			_slots = _allocker.allocate(new_capacity);
+			_capacity = new_capacity;
+			for (size_type i = 0; i != old_capacity; i++)
+			{
+				if (!ctrl_is_full(old_ctrl[i]))
+					continue ;
+
+				size_type	hash = _hash(old_slots[i].first);
+				size_type	j = find_free_slot(hash);
+
+				ft::relocate(_allocker, &_slots[j], &old_slots[i], 1);
+				set_ctrl(j, h2(hash));
+			}
+			_growth_left = max_elements(_capacity) - _size;
+			if (old_capacity)
+			{
+				_ctrl_allocker.deallocate(old_ctrl, old_capacity + ctrl_group::width);
+				_allocker.deallocate(old_slots, old_capacity);
+			}
+		}
+
+		//same capacity and same layout: no hashing and no probing
+		void	copy_table( const unordered_map& x )
+		{
+			if (x._size == 0)
+				return ;
+			_ctrl = allocate_ctrl(x._capacity);
+			_slots = _allocker.allocate(x._capacity);
+			_capacity = x._capacity;
+			for (size_type i = 0; i != _capacity; i++)
+			{
+				if (ctrl_is_full(x._ctrl[i]))
+					_allocker.construct(&_slots[i], x._slots[i]);
+			}
+			std::memcpy(_ctrl, x._ctrl, _capacity + ctrl_group::width);
+			_size = x._size;
+			_growth_left = x._growth_left;
+		}
+
+		void	destroy_slots( void )
+		{
+			for (size_type i = 0; i != _capacity; i++)
+			{
+				if (ctrl_is_full(_ctrl[i]))
+					_allocker.destroy(&_slots[i]);
+			}
+		}
+
+		//back to the empty, unallocated table
+		void	destroy_table( void )
+		{
+			if (_capacity)
+			{
+				destroy_slots();
+				_ctrl_allocker.deallocate(_ctrl, _capacity + ctrl_group::width);
+				_allocker.deallocate(_slots, _capacity);
+			}
+			_ctrl = empty_ctrl_group();
+			_slots = NULL;
+			_capacity = 0;
+			_size = 0;
+			_growth_left = 0;
+		}
+
+		//a slot goes back to empty when no group read through it could have
+		//been full: then no probe ever went past it. A tombstone otherwise
+		void	erase_index( size_type i )
+		{
+			group_mask	empty_after = ctrl_group(_ctrl + i).match_empty();
+			group_mask	empty_before = ctrl_group(_ctrl + ((i - ctrl_group::width) & _capacity)).match_empty();
+			bool		was_never_full = empty_after && empty_before
+				&& group_mask_ctz(empty_after) + group_mask_clz(empty_before) < ctrl_group::width;
+
+			_allocker.destroy(&_slots[i]);
+			set_ctrl(i, was_never_full ? ctrl_empty : ctrl_deleted);
+			_growth_left += was_never_full;
+			_size--;
+		}
+
+		iterator		make_iterator( size_type i ) { return (iterator(_ctrl + i, _slots + i)); }
+		const_iterator	make_iterator( size_type i ) const { return (const_iterator(_ctrl + i, _slots + i)); }
+
+	public:
+		ft::pair<iterator,bool> insert (const value_type& val){
+			size_type	hash = _hash(val.first);
+			size_type	i = find_index(val.first, hash);
+
+			if (i != _capacity)
+				return (ft::make_pair(make_iterator(i), false));
+			i = prepare_insert(hash);
+			_allocker.construct(&_slots[i], val);
+			occupy(i, hash);
+			return (ft::make_pair(make_iterator(i), true));
+		}
+
+		//there is no order to keep, the hint is of no use
+		iterator insert (const_iterator, const value_type& val) { return (insert(val).first); }
+
+		template <class InputIterator>
+		void insert (InputIterator first, InputIterator last){
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+#if __cplusplus >= 201103L
+		//the key is looked up before anything is built or moved from
+		ft::pair<iterator,bool> insert (value_type&& val) {
+			return (emplace_unique(val.first, std::move(val)));
+		}
+
+		//the pair has to exist before its key can be hashed
+		template <class... Args>
+		ft::pair<iterator,bool> emplace (Args&&... args) {
+			value_type	tmp(std::forward<Args>(args)...);
+
+			return (emplace_unique(tmp.first, std::move(tmp)));
+		}
+
+		//args are left untouched when k is already there
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (const key_type& k, Args&&... args) {
+			return (emplace_key(k, std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		ft::pair<iterator,bool> try_emplace (key_type&& k, Args&&... args) {
+			return (emplace_key(std::move(k), std::forward<Args>(args)...));
+		}
+
+	private:
+		template <class... Args>
+		ft::pair<iterator,bool>	emplace_unique( const key_type& k, Args&&... args )
+		{
+			size_type	hash = _hash(k);
+			size_type	i = find_index(k, hash);
+
+			if (i != _capacity)
+				return (ft::make_pair(make_iterator(i), false));
+			i = prepare_insert(hash);
+			std::allocator_traits<allocator_type>::construct(_allocker, &_slots[i], std::forward<Args>(args)...);
+			occupy(i, hash);
+			return (ft::make_pair(make_iterator(i), true));
+		}
+
+		//the mapped value is only built once k is known to be missing
+		template <class K, class... Args>
+		ft::pair<iterator,bool>	emplace_key( K&& k, Args&&... args )
+		{
+			size_type	hash = _hash(k);
+			size_type	i = find_index(k, hash);
+
+			if (i != _capacity)
+				return (ft::make_pair(make_iterator(i), false));
+			i = prepare_insert(hash);
+			std::allocator_traits<allocator_type>::construct(_allocker, &_slots[i], std::forward<K>(k), mapped_type(std::forward<Args>(args)...));
+			occupy(i, hash);
+			return (ft::make_pair(make_iterator(i), true));
+		}
+
+	public:
+#endif
+		void		erase( const_iterator position ) { erase_index(position.ctrl() - _ctrl); }
+
+		//erasing never moves the other elements, first stays valid
+		void		erase( const_iterator first, const_iterator last )
+		{
+			while (first != last)
+				erase(first++);
+		}
+
+		size_type	erase( const key_type& k )
+		{
+			size_type	i = find_index(k, _hash(k));
+
+			if (i == _capacity)
+				return 0;
+			erase_index(i);
+			return 1;
+		}
+
+	//ITERATORS//
+	public:
+		iterator		begin( void ) { return (iterator(_ctrl, _slots)); }
+		const_iterator	begin( void ) const { return (const_iterator(_ctrl, _slots)); }
+		iterator		end( void ) { return (make_iterator(_capacity)); }
+		const_iterator	end( void ) const { return (make_iterator(_capacity)); }
+
+		iterator		find( const key_type& k ) { return (make_iterator(find_index(k, _hash(k)))); }
+		const_iterator	find( const key_type& k ) const { return (make_iterator(find_index(k, _hash(k)))); }
+		size_type		count( const key_type& k ) const { return (find_index(k, _hash(k)) != _capacity); }
+
+		ft::pair<iterator,iterator>				equal_range( const key_type& k )
+		{
+			iterator	it = find(k);
+
+			if (it == end())
+				return (ft::make_pair(it, it));
+			iterator	next = it;
+			return (ft::make_pair(it, ++next));
+		}
+
+		ft::pair<const_iterator,const_iterator>	equal_range( const key_type& k ) const
+		{
+			const_iterator	it = find(k);
+
+			if (it == end())
+				return (ft::make_pair(it, it));
+			const_iterator	next = it;
+			return (ft::make_pair(it, ++next));
+		}
+
+#if __cplusplus >= 201103L
+		mapped_type& operator[] (const key_type& k)
+		{
+			return (*(try_emplace(k).first)).second;
+		}
+
+		mapped_type& operator[] (key_type&& k)
+		{
+			return (*(try_emplace(std::move(k)).first)).second;
+		}
+#else
+		mapped_type& operator[] (const key_type& k)
+		{
+			size_type	hash = _hash(k);
+			size_type	i = find_index(k, hash);
+
+			if (i == _capacity)
+			{
+				i = prepare_insert(hash);
+				_allocker.construct(&_slots[i], value_type(k, mapped_type()));
+				occupy(i, hash);
+			}
+			return (_slots[i].second);
+		}
+#endif
+
+		mapped_type&		at( const key_type& k )
+		{
+			size_type	i = find_index(k, _hash(k));
+
+			if (i == _capacity)
+				throw std::out_of_range("unordered_map::at");
+			return (_slots[i].second);
+		}
+
+		const mapped_type&	at( const key_type& k ) const
+		{
+			size_type	i = find_index(k, _hash(k));
+
+			if (i == _capacity)
+				throw std::out_of_range("unordered_map::at");
+			return (_slots[i].second);
+		}
+
+	//CAPACITY AND HASH POLICY//
+	public:
+		//the slots are kept for what comes next
+		void	clear( void )
+		{
+			if (!_capacity)
+				return ;
+			destroy_slots();
+			std::memset(_ctrl, ctrl_empty, _capacity + ctrl_group::width);
+			_ctrl[_capacity] = ctrl_sentinel;
+			_size = 0;
+			_growth_left = max_elements(_capacity);
+		}
+
+		size_type		size( void ) const { return _size; }
+		size_type		max_size( void ) const { return _allocker.max_size(); }
+		bool			empty( void ) const { return (_size == 0); }
+		allocator_type	get_allocator( void ) const { return _allocker; }
+		hasher			hash_function( void ) const { return _hash; }
+		key_equal		key_eq( void ) const { return _equal; }
+
+		size_type		bucket_count( void ) const { return _capacity; }
+		float			load_factor( void ) const { return (_capacity ? static_cast<float>(_size) / _capacity : 0.0f); }
+		float			max_load_factor( void ) const { return _max_load_factor; }
+
+		//in (0, 1], one slot stays empty whatever the factor. The table is
+		//rehashed when what it holds, tombstones included, goes over it
+		void	max_load_factor( float z )
+		{
+			size_type	used = max_elements(_capacity) - _growth_left;
+
+			if (!(z > 0.0f && z <= 1.0f))
+				throw std::invalid_argument("unordered_map::max_load_factor");
+			_max_load_factor = z;
+			if (!_capacity)
+				return ;
+			if (used > max_elements(_capacity))
+				resize(normalize_capacity(_size) > _capacity ? normalize_capacity(_size) : _capacity);
+			else
+				_growth_left = max_elements(_capacity) - used;
+		}
+
+		//at least n slots, never less than size() needs
+		void	rehash( size_type n )
+		{
+			size_type	capacity = normalize_capacity(_size);
+
+			while (capacity < n)
+				capacity = capacity * 2 + 1;
+			if (_size == 0 && n == 0)
+				destroy_table();
+			else if (capacity != _capacity)
+				resize(capacity);
+		}
+
+		//room for n elements without a rehash
+		void	reserve( size_type n )
+		{
+			if (n > max_elements(_capacity))
+				resize(normalize_capacity(n));
+		}
+
+		void	swap( unordered_map& x )
+		{
+			std::swap(_hash, x._hash);
+			std::swap(_equal, x._equal);
+			std::swap(_allocker, x._allocker);
+			std::swap(_ctrl_allocker, x._ctrl_allocker);
+			std::swap(_ctrl, x._ctrl);
+			std::swap(_slots, x._slots);
+			std::swap(_capacity, x._capacity);
+			std::swap(_size, x._size);
+			std::swap(_growth_left, x._growth_left);
+			std::swap(_max_load_factor, x._max_load_factor);
+		}
+};
+
+template <class Key, class T, class Hash, class Pred, class Alloc>
+void swap (unordered_map<Key,T,Hash,Pred,Alloc>& x, unordered_map<Key,T,Hash,Pred,Alloc>& y){
+	x.swap(y);
+}
+
+//same keys mapped to equal values, whatever the order of the slots
+template <class Key, class T, class Hash, class Pred, class Alloc>
+bool operator== ( const unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const unordered_map<Key,T,Hash,Pred,Alloc>& rhs ){
+	if (lhs.size() != rhs.size())
+		return false;
+	for (typename unordered_map<Key,T,Hash,Pred,Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+	{
+		typename unordered_map<Key,T,Hash,Pred,Alloc>::const_iterator other = rhs.find(it->first);
+
+		if (other == rhs.end() || !(other->second == it->second))
+			return false;
+	}
+	return true;
+}
+
+template <class Key, class T, class Hash, class Pred, class Alloc>
+bool operator!= ( const unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const unordered_map<Key,T,Hash,Pred,Alloc>& rhs ){
+	return (!(lhs == rhs));
+}
+
+}
+
+#endif
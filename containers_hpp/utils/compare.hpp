@@ -0,0 +1,275 @@
+#ifndef __COMPARE_HPP__
+# define __COMPARE_HPP__
+
+# include <cstddef>
+# include <cstring>
+# include "traits.hpp"
+
+# if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#  define FT_COMPARE_X86 1
+#  include <immintrin.h>
+# else
+#  define FT_COMPARE_X86 0
+# endif
+
+namespace ft{
+
+//kernels returning the index of the first mismatch of two arrays, or n.
+//x86 gets SSE2 (always there on x86-64) and AVX2 picked at run time
+inline std::size_t	mismatch_bytes_scalar( const unsigned char * a, const unsigned char * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	while (i != n && a[i] == b[i])
+		i++;
+	return (i);
+}
+
+template <class F>
+inline std::size_t	mismatch_float_scalar( const F * a, const F * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	while (i != n && a[i] == b[i])
+		i++;
+	return (i);
+}
+
+#if FT_COMPARE_X86
+inline std::size_t	mismatch_bytes_sse2( const unsigned char * a, const unsigned char * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		__m128i		x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+		__m128i		y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+		unsigned	diff = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFFu;
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_bytes_scalar(a + i, b + i, n - i));
+}
+
+__attribute__((target("avx2")))
+inline std::size_t	mismatch_bytes_avx2( const unsigned char * a, const unsigned char * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 32 <= n; i += 32)
+	{
+		__m256i		x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+		__m256i		y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+		unsigned	diff = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_bytes_sse2(a + i, b + i, n - i));
+}
+
+//a lane mismatches when !(a == b), NaN included, as the scalar loop does
+inline std::size_t	mismatch_float_sse2( const float * a, const float * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		int	diff = _mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_float_scalar(a + i, b + i, n - i));
+}
+
+__attribute__((target("avx2")))
+inline std::size_t	mismatch_float_avx2( const float * a, const float * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 8 <= n; i += 8)
+	{
+		int	diff = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_NEQ_UQ));
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_float_sse2(a + i, b + i, n - i));
+}
+
+inline std::size_t	mismatch_float_sse2( const double * a, const double * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 2 <= n; i += 2)
+	{
+		int	diff = _mm_movemask_pd(_mm_cmpneq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_float_scalar(a + i, b + i, n - i));
+}
+
+__attribute__((target("avx2")))
+inline std::size_t	mismatch_float_avx2( const double * a, const double * b, std::size_t n )
+{
+	std::size_t	i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		int	diff = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_NEQ_UQ));
+
+		if (diff)
+			return (i + __builtin_ctz(diff));
+	}
+	return (i + mismatch_float_sse2(a + i, b + i, n - i));
+}
+
+inline bool	has_avx2( void )
+{
+	return (__builtin_cpu_supports("avx2"));
+}
+#endif
+
+inline std::size_t	mismatch_bytes( const void * a, const void * b, std::size_t n )
+{
+	const unsigned char	*x = static_cast<const unsigned char *>(a);
+	const unsigned char	*y = static_cast<const unsigned char *>(b);
+
+#if FT_COMPARE_X86
+	if (n >= 32 && has_avx2())
+		return (mismatch_bytes_avx2(x, y, n));
+	return (mismatch_bytes_sse2(x, y, n));
+#else
+	return (mismatch_bytes_scalar(x, y, n));
+#endif
+}
+
+template <class F>
+inline std::size_t	mismatch_float( const F * a, const F * b, std::size_t n )
+{
+#if FT_COMPARE_X86
+	if (n >= 8 && has_avx2())
+		return (mismatch_float_avx2(a, b, n));
+	return (mismatch_float_sse2(a, b, n));
+#else
+	return (mismatch_float_scalar(a, b, n));
+#endif
+}
+
+//how two arrays of T can be compared: with their bytes (integers have no
+//padding and a single representation per value), lane by lane (float and
+//double, -0.0 == 0.0 and NaN != NaN) or one operator at a time
+struct compare_generic_tag {};
+struct compare_bytes_tag {};
+struct compare_float_tag {};
+
+template <class T>
+struct compare_category
+{
+	typedef typename ft::conditional<ft::is_integral<T>::value, compare_bytes_tag, compare_generic_tag>::type	type;
+};
+
+template <>
+struct compare_category<float> { typedef compare_float_tag type; };
+
+template <>
+struct compare_category<double> { typedef compare_float_tag type; };
+
+template <class T>
+struct compare_category<const T> : public compare_category<T> {};
+
+template <class T>
+bool	contiguous_equal( const T * a, const T * b, std::size_t n, compare_generic_tag )
+{
+	for (std::size_t i = 0; i != n; i++)
+	{
+		if (!(a[i] == b[i]))
+			return false;
+	}
+	return true;
+}
+
+template <class T>
+bool	contiguous_equal( const T * a, const T * b, std::size_t n, compare_bytes_tag )
+{
+	return (n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0);
+}
+
+template <class T>
+bool	contiguous_equal( const T * a, const T * b, std::size_t n, compare_float_tag )
+{
+	return (mismatch_float(a, b, n) == n);
+}
+
+//true when the n elements at a and b are all equal
+template <class T>
+bool	contiguous_equal( const T * a, const T * b, std::size_t n )
+{
+	return (contiguous_equal(a, b, n, typename compare_category<T>::type()));
+}
+
+template <class T>
+bool	contiguous_less( const T * a, std::size_t na, const T * b, std::size_t nb, compare_generic_tag )
+{
+	std::size_t	n = na < nb ? na : nb;
+
+	for (std::size_t i = 0; i != n; i++)
+	{
+		if (a[i] < b[i])
+			return true;
+		if (b[i] < a[i])
+			return false;
+	}
+	return (na < nb);
+}
+
+template <class T>
+bool	contiguous_less( const T * a, std::size_t na, const T * b, std::size_t nb, compare_bytes_tag )
+{
+	std::size_t	n = na < nb ? na : nb;
+
+	if (n == 0)
+		return (na < nb);
+	//memcmp orders unsigned bytes the way operator< does
+	if (sizeof(T) == 1 && !(static_cast<T>(-1) < static_cast<T>(0)))
+	{
+		int	ret = std::memcmp(a, b, n);
+
+		return (ret ? ret < 0 : na < nb);
+	}
+
+	std::size_t	i = mismatch_bytes(a, b, n * sizeof(T)) / sizeof(T);
+
+	return (i != n ? a[i] < b[i] : na < nb);
+}
+
+template <class T>
+bool	contiguous_less( const T * a, std::size_t na, const T * b, std::size_t nb, compare_float_tag )
+{
+	std::size_t	n = na < nb ? na : nb;
+
+	//NaN lanes are neither less nor greater, the scan goes on past them
+	for (std::size_t i = mismatch_float(a, b, n); i != n; i += 1 + mismatch_float(a + i + 1, b + i + 1, n - i - 1))
+	{
+		if (a[i] < b[i])
+			return true;
+		if (b[i] < a[i])
+			return false;
+	}
+	return (na < nb);
+}
+
+//lexicographical a < b over two arrays
+template <class T>
+bool	contiguous_less( const T * a, std::size_t na, const T * b, std::size_t nb )
+{
+	return (contiguous_less(a, na, b, nb, typename compare_category<T>::type()));
+}
+
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef __CTRL_GROUP_HPP__
+# define __CTRL_GROUP_HPP__
+
+# include <cstddef>
+# include <cstring>
+
+# if defined(__SSE2__) || defined(__x86_64__)
+#  define FT_CTRL_GROUP_SSE2 1
+#  include <emmintrin.h>
+# else
+#  define FT_CTRL_GROUP_SSE2 0
+# endif
+
+namespace ft{
+
+//control bytes of ft::unordered_map, one per slot. A full slot stores the
+//low 7 bits of its hash, the other states are negative
+typedef signed char		ctrl_t;
+
+static const ctrl_t		ctrl_empty = -128;
+static const ctrl_t		ctrl_deleted = -2;
+static const ctrl_t		ctrl_sentinel = -1;
+
+inline bool	ctrl_is_full( ctrl_t c ) { return (c >= 0); }
+
+//bit i set when byte i of the group matched
+typedef unsigned int	group_mask;
+
+//index of the lowest set bit, m must not be 0
+inline std::size_t	group_mask_ctz( group_mask m )
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (__builtin_ctz(m));
+#else
+	std::size_t	n = 0;
+
+	for (; !(m & 1); m >>= 1)
+		n++;
+	return (n);
+#endif
+}
+
+//zero bits above the highest set one, out of the 16 of a group
+inline std::size_t	group_mask_clz( group_mask m )
+{
+	std::size_t	n = 0;
+
+	for (group_mask bit = 0x8000u; bit && !(m & bit); bit >>= 1)
+		n++;
+	return (n);
+}
+
+//16 control bytes read at once, with SSE2 where there is one
+class ctrl_group
+{
+	public:
+		static const std::size_t	width = 16;
+
+#if FT_CTRL_GROUP_SSE2
+		explicit ctrl_group( const ctrl_t * ctrl ) : _bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {};
+
+		group_mask	match( ctrl_t h2 ) const { return (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _bytes))); };
+		group_mask	match_empty( void ) const { return (match(ctrl_empty)); };
+		group_mask	match_empty_or_deleted( void ) const { return (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), _bytes))); };
+
+	private:
+		__m128i		_bytes;
+#else
+		explicit ctrl_group( const ctrl_t * ctrl ) { std::memcpy(_bytes, ctrl, width); };
+
+		group_mask	match( ctrl_t h2 ) const
+		{
+			group_mask	m = 0;
+
+			for (std::size_t i = 0; i != width; i++)
+				m |= group_mask(_bytes[i] == h2) << i;
+			return (m);
+		};
+		group_mask	match_empty( void ) const { return (match(ctrl_empty)); };
+		group_mask	match_empty_or_deleted( void ) const
+		{
+			group_mask	m = 0;
+
+			for (std::size_t i = 0; i != width; i++)
+				m |= group_mask(_bytes[i] < ctrl_sentinel) << i;
+			return (m);
+		};
+
+	private:
+		ctrl_t		_bytes[width];
+#endif
+};
+
+//control bytes of a table without slots: a sentinel for the iterators,
+//then empties so that any lookup stops at once
+inline ctrl_t *	empty_ctrl_group( void )
+{
+	static ctrl_t	group[ctrl_group::width] = { ctrl_sentinel,
+		ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+		ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty };
+
+	return (group);
+}
+
+}
+
+#endif
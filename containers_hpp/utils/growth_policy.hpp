@@ -0,0 +1,40 @@
+#ifndef __GROWTH_POLICY_HPP__
+# define __GROWTH_POLICY_HPP__
+
+# include <cstddef>
+
+namespace ft{
+
+//growth policies for ft::vector: next_capacity gets the current capacity and
+//the size we need room for, it returns the capacity of the new buffer.
+//Only amortized growth goes through them, reserve() and assign() of a known
+//size allocate exactly what they are asked for
+
+struct growth_double
+{
+	static std::size_t	next_capacity( std::size_t capacity, std::size_t required ) {
+		return (capacity * 2 > required ? capacity * 2 : required);
+	}
+};
+
+//a freed block can be reused once the sum of the previous ones is big enough
+struct growth_one_and_half
+{
+	static std::size_t	next_capacity( std::size_t capacity, std::size_t required ) {
+		std::size_t grown = capacity + capacity / 2;
+
+		return (grown > required ? grown : required);
+	}
+};
+
+//no slack at all, every push_back past capacity reallocates
+struct growth_exact
+{
+	static std::size_t	next_capacity( std::size_t, std::size_t required ) {
+		return (required);
+	}
+};
+
+}
+
+#endif
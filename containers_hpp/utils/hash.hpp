@@ -0,0 +1,112 @@
+#ifndef __HASH_HPP__
+# define __HASH_HPP__
+
+# include <cstddef>
+# include <cstring>
+# include <climits>
+# include <string>
+# include "traits.hpp"
+
+namespace ft{
+
+//hashes meant for open addressing: every input bit reaches every output
+//bit, the low 7 bits and the high ones are both used by ft::unordered_map
+#if ULONG_MAX > 0xffffffffUL
+//murmur3 64 bit finalizer
+inline std::size_t	hash_mix( std::size_t h )
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdUL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53UL;
+	h ^= h >> 33;
+	return (h);
+}
+
+static const std::size_t	hash_multiplier = 0x9e3779b97f4a7c15UL;
+#else
+//murmur3 32 bit finalizer
+inline std::size_t	hash_mix( std::size_t h )
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bUL;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35UL;
+	h ^= h >> 16;
+	return (h);
+}
+
+static const std::size_t	hash_multiplier = 0x9e3779b9UL;
+#endif
+
+//a word of input at a time, the tail is read with a memcpy too
+inline std::size_t	hash_bytes( const void * data, std::size_t n )
+{
+	const unsigned char	*p = static_cast<const unsigned char *>(data);
+	std::size_t			h = n * hash_multiplier;
+	std::size_t			w;
+
+	for (; n >= sizeof(w); n -= sizeof(w), p += sizeof(w))
+	{
+		std::memcpy(&w, p, sizeof(w));
+		h = (h ^ hash_mix(w)) * hash_multiplier;
+	}
+	if (n)
+	{
+		w = 0;
+		std::memcpy(&w, p, n);
+		h = (h ^ hash_mix(w)) * hash_multiplier;
+	}
+	return (hash_mix(h));
+}
+
+//integral types, the primary template. Specialize it for your own keys
+template <class T>
+struct hash
+{
+	typedef T				argument_type;
+	typedef std::size_t		result_type;
+
+	std::size_t	operator()( T const & x ) const { return (hash_mix(static_cast<std::size_t>(x))); }
+};
+
+template <class T>
+struct hash<T *>
+{
+	typedef T *				argument_type;
+	typedef std::size_t		result_type;
+
+	std::size_t	operator()( T * x ) const { return (hash_mix(reinterpret_cast<std::size_t>(x))); }
+};
+
+//-0.0 == 0.0, they must hash the same
+template <>
+struct hash<float>
+{
+	typedef float			argument_type;
+	typedef std::size_t		result_type;
+
+	std::size_t	operator()( float x ) const { return (x == 0.0f ? hash_mix(0) : hash_bytes(&x, sizeof(x))); }
+};
+
+template <>
+struct hash<double>
+{
+	typedef double			argument_type;
+	typedef std::size_t		result_type;
+
+	std::size_t	operator()( double x ) const { return (x == 0.0 ? hash_mix(0) : hash_bytes(&x, sizeof(x))); }
+};
+
+template <>
+struct hash<std::string>
+{
+	typedef std::string		argument_type;
+	typedef std::size_t		result_type;
+
+	std::size_t	operator()( std::string const & x ) const { return (hash_bytes(x.data(), x.size())); }
+};
+
+}
+
+#endif
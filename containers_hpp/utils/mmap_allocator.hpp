@@ -0,0 +1,123 @@
+#ifndef __MMAP_ALLOCATOR_HPP__
+# define __MMAP_ALLOCATOR_HPP__
+
+# include <cstddef>
+# include <cstring>
+# include <new>
+# include <sys/mman.h>
+# include <unistd.h>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "traits.hpp"
+
+namespace ft{
+
+//small blocks come from operator new, large ones are anonymous mappings.
+//reallocate() lets ft::vector grow a mapping without copying: on Linux
+//mremap moves the pages themselves, elsewhere we map, copy and unmap.
+//stateless, every instance can free what another one allocated
+template < class T >
+class mmap_allocator
+{
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template < class U >
+		struct rebind { typedef mmap_allocator<U> other; };
+
+		//below this many bytes a mapping would waste more than it saves
+		enum { MMAP_THRESHOLD = 1 << 20 };
+
+	public:
+		mmap_allocator( void ) {}
+		mmap_allocator( mmap_allocator const & ) {}
+		template < class U >
+		mmap_allocator( mmap_allocator<U> const & ) {}
+		~mmap_allocator( void ) {}
+
+		pointer			address( reference x ) const { return &x; }
+		const_pointer	address( const_reference x ) const { return &x; }
+		size_type		max_size( void ) const { return (size_type(-1) / sizeof(T)); }
+#if __cplusplus >= 201103L
+		template < class U, class... Args >
+		void			construct( U * p, Args&&... args ) { new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+#else
+		void			construct( pointer p, const_reference val ) { new(static_cast<void*>(p)) T(val); }
+#endif
+		void			destroy( pointer p ) { p->~T(); }
+
+		pointer	allocate( size_type n, const void * = 0 )
+		{
+			if (!is_mapped(n))
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+
+			void	*ret = mmap(NULL, mapping_size(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (ret == MAP_FAILED)
+				throw std::bad_alloc();
+			return (static_cast<pointer>(ret));
+		}
+
+		void	deallocate( pointer p, size_type n )
+		{
+			if (!p)
+				return ;
+			if (is_mapped(n))
+				munmap(p, mapping_size(n));
+			else
+				::operator delete(p);
+		}
+
+		//the first min(old_n, new_n) objects keep their bytes, p is released.
+		//only valid for objects that can be moved around with memcpy
+		pointer	reallocate( pointer p, size_type old_n, size_type new_n )
+		{
+			if (!p)
+				return (allocate(new_n));
+#ifdef __linux__
+			if (is_mapped(old_n) && is_mapped(new_n))
+			{
+				void	*ret = mremap(p, mapping_size(old_n), mapping_size(new_n), MREMAP_MAYMOVE);
+
+				if (ret == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(ret));
+			}
+#endif
+			pointer	ret = allocate(new_n);
+
+			std::memcpy(static_cast<void*>(ret), static_cast<const void*>(p), (old_n < new_n ? old_n : new_n) * sizeof(T));
+			deallocate(p, old_n);
+			return (ret);
+		}
+
+	private:
+		static bool	is_mapped( size_type n ) { return (n * sizeof(T) >= MMAP_THRESHOLD); }
+
+		static size_type	mapping_size( size_type n )
+		{
+			size_type	page = sysconf(_SC_PAGESIZE);
+
+			return ((n * sizeof(T) + page - 1) / page * page);
+		}
+};
+
+template < class T >
+struct allocator_reallocates< mmap_allocator<T> > : public true_type {};
+
+template < class T, class U >
+bool	operator==( mmap_allocator<T> const &, mmap_allocator<U> const & ) { return true; }
+
+template < class T, class U >
+bool	operator!=( mmap_allocator<T> const &, mmap_allocator<U> const & ) { return false; }
+
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef __NODE_POOL_ALLOCATOR_HPP__
+# define __NODE_POOL_ALLOCATOR_HPP__
+
+# include <cstddef>
+# include <new>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft{
+
+//blocks of one size carved out of slabs and recycled through an intrusive
+//free list. Once no block is left alive every slab but the newest goes back
+//to the system, the newest one is carved again from its start
+struct node_pool
+{
+	enum { FIRST_SLAB_SIZE = 32, MAX_SLAB_SIZE = 8192, SLAB_HEADER = 16 };
+
+	struct free_node { free_node *next; };
+	struct slab { slab *next; std::size_t count; };
+
+	node_pool		*next;
+	std::size_t		stride;
+	std::size_t		live;
+	std::size_t		next_slab_size;
+	slab			*slabs;
+	free_node		*free_list;
+	char			*cursor;
+	char			*slab_end;
+
+	node_pool( std::size_t block_size, node_pool * next_pool ) : next(next_pool), stride(block_size), live(0),
+		next_slab_size(FIRST_SLAB_SIZE), slabs(NULL), free_list(NULL), cursor(NULL), slab_end(NULL) {}
+	~node_pool( void ) { release_slabs(NULL); }
+
+	//free blocks hold the list link, a block is never smaller than that
+	static std::size_t	stride_for( std::size_t size ) { return (size < sizeof(free_node) ? sizeof(free_node) : size); }
+
+	void *	allocate( void )
+	{
+		void	*ret;
+
+		if (free_list)
+		{
+			ret = free_list;
+			free_list = free_list->next;
+		}
+		else
+		{
+			if (cursor == slab_end)
+				add_slab();
+			ret = cursor;
+			cursor += stride;
+		}
+		live++;
+		return (ret);
+	}
+
+	void	deallocate( void * p )
+	{
+		free_node	*node = static_cast<free_node*>(p);
+
+		node->next = free_list;
+		free_list = node;
+		if (--live == 0)
+			release_slabs(slabs);
+	}
+
+	void	add_slab( void )
+	{
+		std::size_t	count = next_slab_size;
+		char		*raw = static_cast<char*>(::operator new(SLAB_HEADER + count * stride));
+		slab		*new_slab = reinterpret_cast<slab*>(raw);
+
+		new_slab->next = slabs;
+		new_slab->count = count;
+		slabs = new_slab;
+		carve(new_slab);
+		if (count < MAX_SLAB_SIZE)
+			next_slab_size = count * 2;
+	}
+
+	void	carve( slab * from )
+	{
+		cursor = reinterpret_cast<char*>(from) + SLAB_HEADER;
+		slab_end = cursor + from->count * stride;
+	}
+
+	//every slab but keep, which starts over empty (NULL frees them all)
+	void	release_slabs( slab * keep )
+	{
+		while (slabs)
+		{
+			slab *next_slab = slabs->next;
+
+			if (slabs != keep)
+				::operator delete(slabs);
+			slabs = next_slab;
+		}
+		free_list = NULL;
+		slabs = keep;
+		if (keep)
+		{
+			keep->next = NULL;
+			carve(keep);
+		}
+		else
+		{
+			cursor = NULL;
+			slab_end = NULL;
+		}
+	}
+};
+
+//the pools of an allocator and of everything rebound from it, one per
+//block size, so a rebound copy frees into the pool that allocated
+struct node_pool_set
+{
+	node_pool		*pools;
+	std::size_t		refs;
+
+	node_pool_set( void ) : pools(NULL), refs(1) {}
+	~node_pool_set( void )
+	{
+		while (pools)
+		{
+			node_pool *next = pools->next;
+
+			delete pools;
+			pools = next;
+		}
+	}
+
+	node_pool *	pool_for( std::size_t size )
+	{
+		std::size_t	stride = node_pool::stride_for(size);
+
+		for (node_pool *pool = pools; pool; pool = pool->next)
+			if (pool->stride == stride)
+				return (pool);
+		pools = new node_pool(stride, pools);
+		return (pools);
+	}
+};
+
+//single objects come from a node_pool, arrays straight from operator new.
+//copies and rebinds share the same pools and compare equal
+template < class T >
+class node_pool_allocator
+{
+	template < class U >
+	friend class node_pool_allocator;
+
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template < class U >
+		struct rebind { typedef node_pool_allocator<U> other; };
+
+	private:
+		node_pool_set	*_pools;
+		node_pool		*_pool;
+
+	public:
+		node_pool_allocator( void ) : _pools(new node_pool_set), _pool(_pools->pool_for(sizeof(T))) {}
+		node_pool_allocator( node_pool_allocator const & src ) : _pools(src._pools), _pool(src._pool) { _pools->refs++; }
+		template < class U >
+		node_pool_allocator( node_pool_allocator<U> const & src ) : _pools(src._pools), _pool(_pools->pool_for(sizeof(T))) { _pools->refs++; }
+		~node_pool_allocator( void ) { release_pools(); }
+
+		node_pool_allocator & operator=( node_pool_allocator const & src )
+		{
+			if (_pools != src._pools)
+			{
+				release_pools();
+				_pools = src._pools;
+				_pools->refs++;
+			}
+			_pool = src._pool;
+			return *this;
+		}
+
+		pointer			address( reference x ) const { return &x; }
+		const_pointer	address( const_reference x ) const { return &x; }
+		size_type		max_size( void ) const { return (size_type(-1) / node_pool::stride_for(sizeof(T))); }
+#if __cplusplus >= 201103L
+		template < class U, class... Args >
+		void			construct( U * p, Args&&... args ) { new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+#else
+		void			construct( pointer p, const_reference val ) { new(static_cast<void*>(p)) T(val); }
+#endif
+		void			destroy( pointer p ) { p->~T(); }
+
+		pointer	allocate( size_type n, const void * = 0 )
+		{
+			if (n != 1)
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			return (static_cast<pointer>(_pool->allocate()));
+		}
+
+		void	deallocate( pointer p, size_type n )
+		{
+			if (n != 1)
+				::operator delete(p);
+			else
+				_pool->deallocate(p);
+		}
+
+		template < class U >
+		bool	shares_pool( node_pool_allocator<U> const & other ) const { return (_pools == other._pools); }
+
+	private:
+		void	release_pools( void )
+		{
+			if (--_pools->refs == 0)
+				delete _pools;
+		}
+};
+
+template < class T, class U >
+bool	operator==( node_pool_allocator<T> const & lhs, node_pool_allocator<U> const & rhs ) {
+	return (lhs.shares_pool(rhs));
+}
+
+template < class T, class U >
+bool	operator!=( node_pool_allocator<T> const & lhs, node_pool_allocator<U> const & rhs ) {
+	return (!(lhs == rhs));
+}
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef __RELOCATE_HPP__
+# define __RELOCATE_HPP__
+
+# include "../containers.hpp"
+# include "traits.hpp"
+# include "utils.hpp"
+
+namespace ft{
+
+template <class Alloc, class T>
+void	relocate( Alloc &, T * dst, T * src, std::size_t n, ft::true_type )
+{
+	if (n)
+		std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+}
+
+template <class Alloc, class T>
+void	relocate( Alloc & allocker, T * dst, T * src, std::size_t n, ft::false_type )
+{
+	if (dst < src)
+	{
+		for (std::size_t i = 0; i != n; i++)
+		{
+			allocker.construct(&dst[i], ft::move_if_noexcept(src[i]));
+			allocker.destroy(&src[i]);
+		}
+	}
+	else if (dst > src)
+	{
+		for (std::size_t i = n; i != 0; i--)
+		{
+			allocker.construct(&dst[i - 1], ft::move_if_noexcept(src[i - 1]));
+			allocker.destroy(&src[i - 1]);
+		}
+	}
+}
+
+//moves n live elements from src to dst (ranges may overlap),
+//the source slots are left raw
+template <class Alloc, class T>
+void	relocate( Alloc & allocker, T * dst, T * src, std::size_t n )
+{
+	relocate(allocker, dst, src, n, ft::is_trivially_relocatable<T>());
+}
+
+}
+
+#endif
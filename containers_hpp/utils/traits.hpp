@@ -88,6 +88,35 @@ struct is_integral<unsigned int> : public true_type{};
 template<>
 struct is_integral<unsigned long int> : public true_type{};
 
+template<typename T>
+struct is_floating_point : public false_type {};
+
+template<>
+struct is_floating_point<float> : public true_type {};
+
+template<>
+struct is_floating_point<double> : public true_type {};
+
+template<>
+struct is_floating_point<long double> : public true_type {};
+
+//true when an object can be moved to a new address with a plain memcpy,
+//leaving nothing to destroy at the old one. Specialize it for your own
+//types (PODs, structs of such types...) to get bitwise relocation in ft::vector
+template<typename T>
+struct is_trivially_relocatable : public integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value> {};
+
+template<typename T>
+struct is_trivially_relocatable<T*> : public true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<const T> : public is_trivially_relocatable<T> {};
+
+//true when the allocator has a reallocate(p, old_n, new_n) member that
+//keeps the bytes of the block, see ft::mmap_allocator
+template<typename Alloc>
+struct allocator_reallocates : public false_type {};
+
 }
 
 #endif
@@ -23,8 +23,8 @@ void print2DUtil(pointer root, int space)
     for (int i = COUNT2; i < space; i++)
         std::cout<<" ";
     std::cout<< root->elem.first << ", ";
-	std::cout << RED << root->depth.balance << RESET <<", ";
-	if (root->parent)
+	std::cout << RED << balance_factor(root) << RESET <<", ";
+	if (root->parent && root->parent->height != 0)
 		std::cout << YELLOW << root->parent->elem.first << RESET << std::endl;
 	else
 		std::cout << FIRE << "NICHT" << RESET << std::endl;
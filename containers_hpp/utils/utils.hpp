@@ -2,6 +2,11 @@
 # define __UTILS_HPP__
 
 #include "traits.hpp"
+#include "compare.hpp"
+#if __cplusplus >= 201103L
+# include <utility>
+# include <type_traits>
+#endif
 
 namespace ft{
 
@@ -21,6 +26,40 @@ bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
 	return (first2 != last2);
 }
 
+//raw arrays go through the kernels of compare.hpp
+template <class T>
+bool lexicographical_compare (T* first1, T* last1, T* first2, T* last2)
+{
+	return (ft::contiguous_less(first1, last1 - first1, first2, last2 - first2));
+}
+
+//moves the elements pred rejects to the front of the range, keeping their
+//order, and returns the new end. Single pass, nothing is moved twice
+template <class ForwardIterator, class UnaryPredicate>
+ForwardIterator remove_if (ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+{
+	while (first != last && !pred(*first))
+		++first;
+	if (first == last)
+		return first;
+
+	ForwardIterator	result = first;
+
+	for (++first; first != last; ++first)
+	{
+		if (!pred(*first))
+		{
+#if __cplusplus >= 201103L
+			*result = std::move(*first);
+#else
+			*result = *first;
+#endif
+			++result;
+		}
+	}
+	return result;
+}
+
 template <class T1, class T2>
 struct pair{
 	typedef T1 first_type;
@@ -36,6 +75,24 @@ struct pair{
 	template<class U, class V> 
 	pair (const pair<U,V>& pr) : first(pr.first), second(pr.second) { };
 
+#if __cplusplus >= 201103L
+	pair( pair const & pr ) = default;
+	pair( pair && pr ) = default;
+
+	template<class U, class V, class = typename std::enable_if< std::is_constructible<T1, U&&>::value && std::is_constructible<T2, V&&>::value >::type>
+	pair( U && a, V && b ) : first(std::forward<U>(a)), second(std::forward<V>(b)) { }
+
+	template<class U, class V>
+	pair( pair<U,V> && pr ) : first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) { }
+
+	pair & operator=( pair && pr )
+	{
+		first = std::move(pr.first);
+		second = std::move(pr.second);
+		return *this;
+	}
+#endif
+
 	pair & operator=( const pair & pr)
 	{
 		if (this != &pr)
@@ -47,6 +104,9 @@ struct pair{
 	}
 };
 
+template <class T1, class T2>
+struct is_trivially_relocatable< pair<T1, T2> > : public integral_constant<bool, is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
+
 template <class T1, class T2>
 bool operator== (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs) { return lhs.first==rhs.first && lhs.second==rhs.second; }
 
@@ -68,9 +128,24 @@ bool operator>= (const pair<T1,T2>& lhs, const pair<T1,T2>& rhs) { return !(lhs<
 template <class T1,class T2>
 ft::pair<T1,T2> make_pair (T1 x, T2 y)
 {
+#if __cplusplus >= 201103L
+	return ( ft::pair<T1,T2>(std::move(x), std::move(y)) );
+#else
 	return ( ft::pair<T1,T2>(x,y) );
+#endif
 }
 
+//relocation source for containers: an rvalue when moving cannot throw,
+//a plain const reference otherwise and in C++98
+#if __cplusplus >= 201103L
+template <class T>
+typename std::conditional< !std::is_nothrow_move_constructible<T>::value && std::is_copy_constructible<T>::value, T const &, T && >::type
+	move_if_noexcept( T & x ) noexcept { return std::move_if_noexcept(x); }
+#else
+template <class T>
+T const &	move_if_noexcept( T & x ) { return x; }
+#endif
+
 template <class Arg1, class Arg2, class Result>
 struct binary_function {
 	typedef Arg1 first_argument_type;
@@ -83,6 +158,11 @@ struct less : binary_function <T,T,bool> {
 	bool operator() (const T& x, const T& y) const {return x<y;}
 };
 
+template <class T> 
+struct equal_to : binary_function <T,T,bool> {
+	bool operator() (const T& x, const T& y) const {return x==y;}
+};
+
 
 }
 
@@ -5,23 +5,26 @@
 # include "iterators/iterator.hpp"
 # include "utils/traits.hpp"
 # include "utils/utils.hpp"
+# include "utils/relocate.hpp"
+# include "utils/growth_policy.hpp"
 
 namespace ft{
 
-template < typename T, typename A = std::allocator<T> >
+template < typename T, typename A = std::allocator<T>, typename Growth = ft::growth_double >
 class vector{
     
     public:
         typedef T 																	value_type;
         typedef A																	allocator_type;
+		typedef Growth																growth_policy;
 		typedef typename A::size_type												size_type;
 		typedef	typename A::difference_type											difference_type;
         typedef typename A::pointer            										pointer;
         typedef typename A::const_pointer      										const_pointer;
         typedef typename A::reference												reference;
         typedef typename A::const_reference    										const_reference;
-		typedef typename ft::RandomAccessIterator< ft::vector<T, A>, false >		iterator;
-		typedef	typename ft::RandomAccessIterator< const ft::vector<T, A>, true >	const_iterator;
+		typedef typename ft::RandomAccessIterator< ft::vector<T, A, Growth>, false >	iterator;
+		typedef	typename ft::RandomAccessIterator< const ft::vector<T, A, Growth>, true >	const_iterator;
 		typedef typename ft::reverse_iterator< iterator >							reverse_iterator;
 		typedef typename ft::reverse_iterator< const_iterator >						const_reverse_iterator;
 	
@@ -33,8 +36,7 @@ class vector{
 				const allocator_type& alloc = allocator_type()) : _allocker(alloc), _size(n), _capacity(n)
 		{
 			_vector = _allocker.allocate(_capacity);
-			for (size_type i = 0; i != _size; i++)
-				_allocker.construct(&_vector[i], val);
+			_fill(_vector, _size, val);
 		};
 
 		template <class InputIterator>
@@ -48,128 +50,148 @@ class vector{
 			*this = x;
 		}
 
+#if __cplusplus >= 201103L
+		vector (vector && x) noexcept : _allocker(x._allocker), _size(x._size), _capacity(x._capacity), _vector(x._vector){
+			x._size = 0;
+			x._capacity = 0;
+			x._vector = NULL;
+		}
+#endif
+
         ~vector( void ) { _destroy_vector(); };
 
+#if __cplusplus >= 201103L
+		iterator insert(iterator position, value_type&& val)
+		{
+			size_type	offset = position - begin();
+
+			_allocker.construct(_open_gap(offset, 1), std::move(val));
+			_size++;
+			return (begin() + offset);
+		}
+
+		//args may refer to an element of the vector, the new value is built
+		//before anything is shifted
+		template <class... Args>
+		iterator emplace(iterator position, Args&&... args)
+		{
+			if (position == end())
+			{
+				emplace_back(std::forward<Args>(args)...);
+				return (end() - 1);
+			}
+			return (insert(position, value_type(std::forward<Args>(args)...)));
+		}
+#endif
+
 		iterator insert(iterator position, const value_type& val)
 		{
-			if (_size + 1 > _capacity)
-				_realloc_memorize_position(std::max(_size + 1, _size * 2), position);
+			size_type	offset = position - begin();
+
 			insert(position, 1, val);
-			return (position);
+			return (begin() + offset);
 		}
 
 		void insert(iterator position, size_type n, const value_type& val)
 		{
-			if (_size + n > _capacity)
-				_realloc_memorize_position(std::max(_size + n, _capacity * 2), position);
-			for (iterator it = end() - 1; it >= position; it--)
-			{
-				_allocker.construct(&(*(it + n)), *it);
-				_allocker.destroy(&(*it));
-			}
-			for (iterator it = position; it != position + n; it++)
-				_allocker.construct(&(*it), val);
+			if (n == 0)
+				return ;
+
+			//val may be an element the gap is about to move
+			value_type	copy(val);
+			pointer		pos = _open_gap(position - begin(), n);
+
+			_fill(pos, n, copy);
 			_size += n;
 		}
 
 		template <class InputIterator>
     	void insert(iterator position, InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0)
 		{
-			for (; first != last; first++)
-			{
-				if (_size + 1 > _capacity)
-					_realloc_memorize_position(_size + 1, position);
-				insert(position, 1, *first);
-				position++;
-			}
+			_range_insert(position, first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		iterator erase (iterator position){
 			return (erase(position, position + 1));
 		}
 
+		//the tail is shifted down once, as a single memmove when T allows it
 		iterator erase (iterator first, iterator last){
-			if (first == last)
-				return first;
-			size_type offset = 0;
-			for(; first != last; first++)
-			{
-				_allocker.destroy(&(*first));
-				offset++;
-			}
-			for (iterator it = last; it != end(); it++)
-			{
-				_allocker.construct(&(*(it - offset)), *it);
-				_allocker.destroy(&(*it));
-			}
-			last -= offset;
-			_size -= offset;
-			return (last);
+			size_type	offset = first - begin();
+			size_type	count = last - first;
+
+			for (size_type i = offset; i != offset + count; i++)
+				_allocker.destroy(&_vector[i]);
+			_relocate(_vector + offset, _vector + offset + count, _size - offset - count);
+			_size -= count;
+			return (begin() + offset);
 		}
 
 		template <class InputIterator>
   		void assign(InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0){
-			size_type	i = 0, oldsize = _size;
-
-			for (; first != last; first++)
-		  	{
-				if (i < _size)
-				{
-				  	_allocker.destroy(&_vector[i]);
-				  	_allocker.construct(&_vector[i], *first);
-				}
-				else
-				{
-					if (i < _capacity)
-					  	_allocker.construct(&_vector[i], *first);
-					else
-					{
-						_realloc((i + 1) * 2);
-						_allocker.construct(&_vector[i], *first);
-					}
-					_size++;
-				}
-				i++;
-			}
-			_size = i;
-			if (_size < oldsize)
-			{
-				for (i = _size; i != oldsize; i++)
-					_allocker.destroy(&_vector[i]);
-			}
+			_range_assign(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		void assign(size_type n, const value_type& val){
+			value_type	copy(val);
+
+			clear();
 			if (n > _capacity)
-			{
 				_realloc(n);
-				for (size_type i = 0; i != n; i++)
-					_allocker.construct(&_vector[i], val);
+			_fill(_vector, n, copy);
+			_size = n;
+		}
+
+#if __cplusplus >= 201103L
+		void	push_back( const value_type & val) { emplace_back(val); }
+		void	push_back( value_type && val) { emplace_back(std::move(val)); }
+
+		template <class... Args>
+		void	emplace_back( Args&&... args )
+		{
+			if (_size == _capacity && _in_place_growth::value)
+			{
+				value_type	tmp(std::forward<Args>(args)...);
+
+				_realloc(_grown_capacity(_size + 1));
+				_allocker.construct(&_vector[_size], std::move(tmp));
 			}
-			else
+			else if (_size == _capacity)
 			{
-				size_type i = 0;
-				for (; i != n; i++)
-				{
-					_allocker.destroy(&_vector[i]);
-					_allocker.construct(&_vector[i], val);
-				}
-				while (i < _size)
-					_allocker.destroy(&_vector[i++]);
+				size_type	new_capacity = _grown_capacity(_size + 1);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				_allocker.construct(&new_vec[_size], std::forward<Args>(args)...);
+				_adopt(new_vec, new_capacity);
 			}
-			_size = n;
+			else
+				_allocker.construct(&_vector[_size], std::forward<Args>(args)...);
+			_size++;
 		}
-
+#else
+		//val may be an element of the vector: it is copied to the new
+		//buffer before the old one goes away
 		void	push_back( const value_type & val) { 
-			if (_size + 1 > _capacity)
+			if (_size == _capacity && _in_place_growth::value)
 			{
-				_realloc(std::max(_size + 1, _capacity * 2));
-				_allocker.construct(&_vector[_size], val);
+				value_type	copy(val);
+
+				_realloc(_grown_capacity(_size + 1));
+				_allocker.construct(&_vector[_size], copy);
+			}
+			else if (_size == _capacity)
+			{
+				size_type	new_capacity = _grown_capacity(_size + 1);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				_allocker.construct(&new_vec[_size], val);
+				_adopt(new_vec, new_capacity);
 			}
 			else
 				_allocker.construct(&_vector[_size], val);
 			_size++;
 		};
+#endif
 
 		void	pop_back( void ) {
 			if (_size == 0)
@@ -188,14 +210,30 @@ class vector{
 				_realloc(n);
 		};
 	
-		void	resize(size_type n, value_type val = value_type()){
-			if (n > _capacity)
+		//capacity becomes exactly max(n, size()), shrinking if need be
+		void	reserve_exact(size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("vector::reserve_exact");
+			if (n < _size)
+				n = _size;
+			if (n == _capacity)
+				return ;
+			if (n == 0)
 			{
-				if (n > _capacity * 2)
-					_realloc(n);
-				else
-					_realloc(_capacity * 2);
+				_allocker.deallocate(_vector, _capacity);
+				_vector = NULL;
+				_capacity = 0;
 			}
+			else
+				_realloc(n);
+		};
+
+		void	shrink_to_fit( void ) { reserve_exact(_size); };
+	
+		void	resize(size_type n, value_type val = value_type()){
+			if (n > _capacity)
+				_realloc(_grown_capacity(n));
 			if ( n < _size)
 			{
 				for (size_type i = n; i != _size; i++)
@@ -204,13 +242,24 @@ class vector{
 			}
 			else if (n > _size)
 			{
-				for (; _size != n; _size++)
-					_allocker.construct(&_vector[_size], val);
+				_fill(_vector + _size, n - _size, val);
+				_size = n;
 			}
 			else 
 				return ;
 		};
 
+		//resize(n) whose new elements are default-initialized: scalars and
+		//PODs are left with whatever the memory held, ready to be read into
+		void	resize_uninitialized(size_type n){
+			if (n > _capacity)
+				_realloc(_grown_capacity(n));
+			while (_size > n)
+				_allocker.destroy(&_vector[--_size]);
+			for (; _size < n; _size++)
+				::new (static_cast<void*>(&_vector[_size])) value_type;
+		};
+
 		void	clear( void )
 		{
 			if (_vector)
@@ -233,6 +282,7 @@ class vector{
 			x._vector = tmp_vector;
 			x._size = tmp_size;
 			x._capacity = tmp_cap;
+			std::swap(_allocker, x._allocker);
 		};
 
 		//ITERATOR BASED FCT
@@ -261,41 +311,151 @@ class vector{
 			}
 		};
 
+		size_type _grown_capacity(size_type required) const
+		{
+			return (Growth::next_capacity(_capacity, required));
+		};
+
 		void _realloc(size_type new_capacity)
 		{
-			pointer new_vec;
+			_realloc(new_capacity, _in_place_growth());
+		};
 
-			new_vec = _allocker.allocate(new_capacity);
-			for (size_type i = 0; i != _size; i++)
-			{
-				_allocker.construct(&new_vec[i], _vector[i]);
-				_allocker.destroy(&_vector[i]);
-			}
-			_allocker.deallocate(_vector, _capacity);
+		void _realloc(size_type new_capacity, ft::false_type)
+		{
+			_adopt(_allocker.allocate(new_capacity), new_capacity);
+		};
+
+		//the allocator resizes the block, elements only need their bytes
+		void _realloc(size_type new_capacity, ft::true_type)
+		{
+			_vector = _allocker.reallocate(_vector, _capacity, new_capacity);
 			_capacity = new_capacity;
-			_vector = new_vec;
 		};
 
-		void _realloc_memorize_position(size_type new_capacity, iterator &position)
+		//relocates the elements into new_vec, which becomes our buffer
+		void _adopt(pointer new_vec, size_type new_capacity)
 		{
-			pointer new_vec;
-
-			new_vec = _allocker.allocate(new_capacity);
-			size_type i = 0;
-			for (; i != _size; i++)
-			{	
-				_allocker.construct(&new_vec[i], _vector[i]);
-				if (position == &(_vector[i]))
-					position = &new_vec[i];
-				_allocker.destroy(&_vector[i]);
-			}
-			if (position == &(_vector[i]))
-				position = &new_vec[i];
+			_relocate(new_vec, _vector, _size);
 			_allocker.deallocate(_vector, _capacity);
 			_capacity = new_capacity;
 			_vector = new_vec;
 		};
 
+		//makes room for n raw slots at offset and returns the first one.
+		//when we have to grow, the tail goes straight to its final place
+		pointer _open_gap(size_type offset, size_type n)
+		{
+			if (_size + n > _capacity && _in_place_growth::value)
+				_realloc(_grown_capacity(_size + n));
+			if (_size + n > _capacity)
+			{
+				size_type	new_capacity = _grown_capacity(_size + n);
+				pointer		new_vec = _allocker.allocate(new_capacity);
+
+				_relocate(new_vec, _vector, offset);
+				_relocate(new_vec + offset + n, _vector + offset, _size - offset);
+				_allocker.deallocate(_vector, _capacity);
+				_capacity = new_capacity;
+				_vector = new_vec;
+			}
+			else
+				_relocate(_vector + offset + n, _vector + offset, _size - offset);
+			return (_vector + offset);
+		};
+
+		//a single pass input range can only be inserted one element at a time
+		template <class InputIterator>
+		void _range_insert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			for (; first != last; first++)
+			{
+				position = insert(position, *first);
+				position++;
+			}
+		}
+
+		template <class ForwardIterator>
+		void _range_insert(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n = std::distance(first, last);
+			pointer		pos = _open_gap(position - begin(), n);
+
+			for (; first != last; first++, pos++)
+				_allocker.construct(pos, *first);
+			_size += n;
+		}
+
+		template <class InputIterator>
+		void _range_assign(InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			size_type	i = 0;
+
+			for (; first != last && i != _size; first++, i++)
+				_vector[i] = *first;
+			if (first == last)
+			{
+				while (_size != i)
+					_allocker.destroy(&_vector[--_size]);
+			}
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void _range_assign(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n = std::distance(first, last);
+			size_type	i = 0;
+
+			if (n > _capacity)
+			{
+				clear();
+				_realloc(n);
+			}
+			for (; i != n && i != _size; first++, i++)
+				_vector[i] = *first;
+			for (; i != n; first++, i++)
+				_allocker.construct(&_vector[i], *first);
+			while (_size > n)
+				_allocker.destroy(&_vector[--_size]);
+			_size = n;
+		}
+
+		void _fill(pointer dst, size_type n, const value_type & val)
+		{
+			_fill(dst, n, val, ft::integral_constant<bool, ft::is_integral<T>::value || ft::is_floating_point<T>::value>());
+		};
+
+		void _fill(pointer dst, size_type n, const value_type & val, ft::false_type)
+		{
+			for (size_type i = 0; i != n; i++)
+				_allocker.construct(&dst[i], val);
+		};
+
+		//a value made of one repeated byte (0, -1, any char) is a memset
+		void _fill(pointer dst, size_type n, const value_type & val, ft::true_type)
+		{
+			const unsigned char	*bytes = reinterpret_cast<const unsigned char *>(&val);
+			size_type			i = 1;
+
+			while (i != sizeof(value_type) && bytes[i] == bytes[0])
+				i++;
+			if (i != sizeof(value_type))
+				_fill(dst, n, val, ft::false_type());
+			else if (n)
+				std::memset(static_cast<void*>(dst), bytes[0], n * sizeof(value_type));
+		};
+
+		void _relocate(pointer dst, pointer src, size_type n)
+		{
+			ft::relocate(_allocker, dst, src, n);
+		};
+
+		//growth keeps the buffer and lets the allocator resize it when it
+		//can, and a bitwise move is all the elements need
+		typedef ft::integral_constant<bool, ft::allocator_reallocates<A>::value && ft::is_trivially_relocatable<T>::value>	_in_place_growth;
+
     private:
         allocator_type	_allocker;
 		size_type		_size;
@@ -303,6 +463,16 @@ class vector{
 		pointer			_vector;
 
 	public:
+#if __cplusplus >= 201103L
+		vector& 		operator= (vector&& x) noexcept {
+			if (this != &x)
+			{
+				_destroy_vector();
+				swap(x);
+			}
+			return (*this);
+		};
+#endif
 		vector& 		operator= (const vector& x){
 			clear();
 			reserve(x._size);
@@ -317,6 +487,8 @@ class vector{
 		const_reference	front( void ) const { return _vector[0]; };
 		reference 		back( void ) { return _vector[_size - 1]; };
 		const_reference back( void ) const { return _vector[_size - 1]; };
+		pointer			data( void ) { return _vector; };
+		const_pointer	data( void ) const { return _vector; };
 		reference 		at (size_type n){
 			if (n < 0 || n >= _size)
 				throw std::out_of_range("ft::vector::at");
@@ -338,54 +510,57 @@ class vector{
 };
 
 //NON-MEMBER
-template <class T, class Alloc>
-void swap(ft::vector<T,Alloc>& x, ft::vector<T,Alloc>& y){
+template <class T, class Alloc, class Growth>
+void swap(ft::vector<T,Alloc,Growth>& x, ft::vector<T,Alloc,Growth>& y){
 	x.swap(y);
 }
 
-template <class T, class Alloc>
-bool operator== (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+//drops every element pred holds for in one linear pass, returns how many
+template <class T, class Alloc, class Growth, class Predicate>
+typename ft::vector<T,Alloc,Growth>::size_type erase_if(ft::vector<T,Alloc,Growth>& c, Predicate pred){
+	typename ft::vector<T,Alloc,Growth>::iterator	it = ft::remove_if(c.begin(), c.end(), pred);
+	typename ft::vector<T,Alloc,Growth>::size_type	count = c.end() - it;
+
+	c.erase(it, c.end());
+	return (count);
+}
+
+template <class T, class Alloc, class Growth>
+bool operator== (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 {
-	if (lhs.size() == rhs.size())
-	{
-		for(typename ft::vector<T,Alloc>::size_type i = 0; i != lhs.size(); i++)
-		{
-			if (lhs.at(i) != rhs.at(i))
-				return false;
-		}
-		return true;
-	}
-	return false;
+	return (lhs.size() == rhs.size() && ft::contiguous_equal(lhs.data(), rhs.data(), lhs.size()));
 }
 
-template <class T, class Alloc>
-bool operator!= (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator!= (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 {
 	return (!(lhs == rhs));
 }
 
-template <class T, class Alloc>
-bool operator<  (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator<  (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 {
-	return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	return (ft::contiguous_less(lhs.data(), lhs.size(), rhs.data(), rhs.size()));
 }
 
-template <class T, class Alloc>
-bool operator>  (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs){
+template <class T, class Alloc, class Growth>
+bool operator>  (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs){
 	return (rhs < lhs);
 }
 
-template <class T, class Alloc>
-bool operator<= (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs){
+template <class T, class Alloc, class Growth>
+bool operator<= (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs){
 	return (!(lhs > rhs));
 }
 
 
-template <class T, class Alloc>
-bool operator>= (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs){
+template <class T, class Alloc, class Growth>
+bool operator>= (const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs){
 	return (!(lhs < rhs));
 }
 
 }
 
+# include "vector_bool.hpp"
+
 #endif
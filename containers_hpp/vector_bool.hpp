@@ -0,0 +1,393 @@
+#ifndef __VECTOR_BOOL_HPP__
+# define __VECTOR_BOOL_HPP__
+
+# include "vector.hpp"
+# include "iterators/bit_iterator.hpp"
+
+namespace ft{
+
+//one bit per element, packed in words. Bits of the last word past size()
+//are always 0, so count(), == and the bitwise operators work on whole words
+template < typename A, typename Growth >
+class vector<bool, A, Growth>{
+
+	public:
+		typedef bool														value_type;
+		typedef A															allocator_type;
+		typedef Growth														growth_policy;
+		typedef std::size_t													size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef ft::bit_reference											reference;
+		typedef bool														const_reference;
+		typedef ft::bit_iterator<false>										iterator;
+		typedef ft::bit_iterator<true>										const_iterator;
+		typedef typename iterator::pointer									pointer;
+		typedef typename const_iterator::pointer							const_pointer;
+		typedef typename ft::reverse_iterator< iterator >					reverse_iterator;
+		typedef typename ft::reverse_iterator< const_iterator >				const_reverse_iterator;
+		typedef ft::bit_word												word_type;
+
+	private:
+		typedef typename A::template rebind<word_type>::other				word_allocator;
+
+	public:
+		explicit vector( const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _size(0), _capacity(0), _words(NULL) {};
+
+		explicit vector( size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type() ) : _allocker(alloc), _size(0), _capacity(0), _words(NULL)
+		{
+			assign(n, val);
+		};
+
+		template <class InputIterator>
+		vector( InputIterator first, InputIterator last,
+				const allocator_type& alloc = allocator_type(), typename enable_if< !is_integral<InputIterator>::value >::type* = 0 ) : _allocker(alloc), _size(0), _capacity(0), _words(NULL)
+		{
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		vector( const vector & x ) : _allocker(x._allocker), _size(0), _capacity(0), _words(NULL)
+		{
+			*this = x;
+		};
+
+#if __cplusplus >= 201103L
+		vector( vector && x ) noexcept : _allocker(x._allocker), _size(x._size), _capacity(x._capacity), _words(x._words)
+		{
+			x._size = 0;
+			x._capacity = 0;
+			x._words = NULL;
+		};
+
+		vector &	operator=( vector && x ) noexcept
+		{
+			if (this != &x)
+			{
+				clear();
+				shrink_to_fit();
+				swap(x);
+			}
+			return (*this);
+		};
+#endif
+
+		~vector( void ) { _allocker.deallocate(_words, _capacity); };
+
+		vector &	operator=( const vector & x )
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			reserve(x._size);
+			if (x._size)
+				std::memcpy(_words, x._words, _words_for(x._size) * sizeof(word_type));
+			_size = x._size;
+			return (*this);
+		};
+
+		//ITERATOR BASED FCT
+		iterator				begin( void ) { return (iterator(_words, 0)); };
+		iterator				end( void ) { return (iterator(_words + _size / bits_per_word, _size % bits_per_word)); };
+		const_iterator			begin( void ) const { return (const_iterator(_words, 0)); };
+		const_iterator			end( void ) const { return (const_iterator(_words + _size / bits_per_word, _size % bits_per_word)); };
+		reverse_iterator		rbegin( void ) { return (reverse_iterator(end())); };
+		reverse_iterator		rend( void ) { return (reverse_iterator(begin())); };
+		const_reverse_iterator	rbegin( void ) const { return (const_reverse_iterator(end())); };
+		const_reverse_iterator	rend( void ) const { return (const_reverse_iterator(begin())); };
+
+		//ACCESS
+		reference		operator[]( size_type n ) { return (reference(&_words[n / bits_per_word], _mask(n))); };
+		const_reference	operator[]( size_type n ) const { return ((_words[n / bits_per_word] & _mask(n)) != 0); };
+		reference		at( size_type n )
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::vector::at");
+			return ((*this)[n]);
+		};
+		const_reference	at( size_type n ) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("ft::vector::at");
+			return ((*this)[n]);
+		};
+		reference		front( void ) { return ((*this)[0]); };
+		const_reference	front( void ) const { return ((*this)[0]); };
+		reference		back( void ) { return ((*this)[_size - 1]); };
+		const_reference	back( void ) const { return ((*this)[_size - 1]); };
+
+		//CAPACITY
+		size_type		size( void ) const { return (_size); };
+		size_type		capacity( void ) const { return (_capacity * bits_per_word); };
+		bool			empty( void ) const { return (_size == 0); };
+		size_type		max_size( void ) const { return (_allocker.max_size() < size_type(-1) / bits_per_word ? _allocker.max_size() * bits_per_word : size_type(-1)); };
+		allocator_type	get_allocator( void ) const { return (allocator_type(_allocker)); };
+
+		void	reserve( size_type n )
+		{
+			if (n > max_size())
+				throw std::length_error("vector::reserve");
+			if (_words_for(n) > _capacity)
+				_realloc(_words_for(n));
+		};
+
+		void	shrink_to_fit( void )
+		{
+			if (_words_for(_size) != _capacity)
+				_realloc(_words_for(_size));
+		};
+
+		void	resize( size_type n, value_type val = value_type() )
+		{
+			if (n < _size)
+			{
+				_size = n;
+				_clear_tail();
+			}
+			else if (n > _size)
+				insert(end(), n - _size, val);
+		};
+
+		//MODIFIERS
+		void	push_back( const value_type & val )
+		{
+			if (_size == capacity())
+				_realloc(_grown_capacity(_size + 1));
+			if (_size % bits_per_word == 0)
+				_words[_size / bits_per_word] = 0;
+			if (val)
+				_words[_size / bits_per_word] |= _mask(_size);
+			_size++;
+		};
+
+		void	pop_back( void )
+		{
+			if (_size == 0)
+				return;
+			_size--;
+			_words[_size / bits_per_word] &= ~_mask(_size);
+		};
+
+		iterator	insert( iterator position, const value_type & val )
+		{
+			size_type	offset = position - begin();
+
+			insert(position, 1, val);
+			return (begin() + offset);
+		};
+
+		void	insert( iterator position, size_type n, const value_type & val )
+		{
+			size_type	offset = position - begin();
+
+			_open_gap(offset, n);
+			_fill(offset, offset + n, val);
+		};
+
+		//the range is copied first, it may be an input range or this vector
+		template <class InputIterator>
+		void	insert( iterator position, InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			vector		tmp(first, last);
+			size_type	offset = position - begin();
+
+			_open_gap(offset, tmp._size);
+			for (size_type i = 0; i != tmp._size; i++)
+				(*this)[offset + i] = tmp[i];
+		}
+
+		iterator	erase( iterator position ) { return (erase(position, position + 1)); };
+
+		iterator	erase( iterator first, iterator last )
+		{
+			size_type	offset = first - begin();
+			size_type	count = last - first;
+
+			for (size_type i = offset + count; i != _size; i++)
+				(*this)[i - count] = (*this)[i];
+			_size -= count;
+			_clear_tail();
+			return (begin() + offset);
+		};
+
+		template <class InputIterator>
+		void	assign( InputIterator first, InputIterator last, typename enable_if< !is_integral<InputIterator>::value >::type* = 0 )
+		{
+			vector	tmp(first, last);
+
+			*this = tmp;
+		}
+
+		void	assign( size_type n, const value_type & val )
+		{
+			clear();
+			insert(end(), n, val);
+		};
+
+		void	swap( vector & x )
+		{
+			std::swap(_allocker, x._allocker);
+			std::swap(_size, x._size);
+			std::swap(_capacity, x._capacity);
+			std::swap(_words, x._words);
+		};
+
+		static void	swap( reference x, reference y )
+		{
+			bool	tmp = x;
+
+			x = y;
+			y = tmp;
+		};
+
+		void	clear( void ) { _size = 0; };
+
+		//BIT OPERATIONS, a word at a time
+		void	flip( void )
+		{
+			for (size_type i = 0; i != _words_for(_size); i++)
+				_words[i] = ~_words[i];
+			_clear_tail();
+		};
+
+		size_type	count( void ) const
+		{
+			size_type	n = 0;
+
+			for (size_type i = 0; i != _words_for(_size); i++)
+				n += ft::popcount_word(_words[i]);
+			return (n);
+		};
+
+		//index of the first true element, size() if there is none
+		size_type	find_first( void ) const { return (_find_from(0)); };
+
+		//index of the first true element after pos, size() if there is none
+		size_type	find_next( size_type pos ) const { return (pos + 1 >= _size ? _size : _find_from(pos + 1)); };
+
+		//both vectors must have the same size
+		vector &	operator&=( vector const & x )
+		{
+			_check_same_size(x, "vector::operator&=");
+			for (size_type i = 0; i != _words_for(_size); i++)
+				_words[i] &= x._words[i];
+			return (*this);
+		};
+
+		vector &	operator|=( vector const & x )
+		{
+			_check_same_size(x, "vector::operator|=");
+			for (size_type i = 0; i != _words_for(_size); i++)
+				_words[i] |= x._words[i];
+			return (*this);
+		};
+
+		vector &	operator^=( vector const & x )
+		{
+			_check_same_size(x, "vector::operator^=");
+			for (size_type i = 0; i != _words_for(_size); i++)
+				_words[i] ^= x._words[i];
+			return (*this);
+		};
+
+		//used words, for comparisons
+		const word_type *	words( void ) const { return (_words); };
+
+	private:
+		static size_type	_words_for( size_type bits ) { return ((bits + bits_per_word - 1) / bits_per_word); };
+		static word_type	_mask( size_type bit ) { return (word_type(1) << (bit % bits_per_word)); };
+
+		size_type	_grown_capacity( size_type required ) const
+		{
+			return (Growth::next_capacity(_capacity, _words_for(required)));
+		};
+
+		void	_realloc( size_type new_capacity )
+		{
+			word_type	*new_words = new_capacity ? _allocker.allocate(new_capacity) : NULL;
+
+			if (_size)
+				std::memcpy(new_words, _words, _words_for(_size) * sizeof(word_type));
+			_allocker.deallocate(_words, _capacity);
+			_words = new_words;
+			_capacity = new_capacity;
+		};
+
+		void	_clear_tail( void )
+		{
+			if (_size % bits_per_word)
+				_words[_size / bits_per_word] &= _mask(_size) - 1;
+		};
+
+		//makes room for n bits at offset, the caller writes them
+		void	_open_gap( size_type offset, size_type n )
+		{
+			if (n == 0)
+				return ;
+			if (_size + n > capacity())
+				_realloc(_grown_capacity(_size + n));
+			for (size_type i = _words_for(_size); i != _words_for(_size + n); i++)
+				_words[i] = 0;
+			_size += n;
+			for (size_type i = _size - 1; i >= offset + n; i--)
+				(*this)[i] = (*this)[i - n];
+		};
+
+		//sets bits [first, last) to val, whole words at once in the middle
+		void	_fill( size_type first, size_type last, bool val )
+		{
+			word_type	pattern = val ? ~word_type(0) : word_type(0);
+
+			while (first != last && first % bits_per_word)
+				(*this)[first++] = val;
+			for (; last - first >= bits_per_word; first += bits_per_word)
+				_words[first / bits_per_word] = pattern;
+			while (first != last)
+				(*this)[first++] = val;
+		};
+
+		size_type	_find_from( size_type pos ) const
+		{
+			size_type	i = pos / bits_per_word;
+			word_type	w;
+
+			if (pos >= _size)
+				return (_size);
+			w = _words[i] & ~(_mask(pos) - 1);
+			while (!w)
+			{
+				if (++i == _words_for(_size))
+					return (_size);
+				w = _words[i];
+			}
+			return (i * bits_per_word + ft::ctz_word(w));
+		};
+
+		void	_check_same_size( vector const & x, const char * what ) const
+		{
+			if (x._size != _size)
+				throw std::invalid_argument(what);
+		};
+
+		word_allocator	_allocker;
+		size_type		_size;
+		size_type		_capacity;
+		word_type		*_words;
+};
+
+template <class Alloc, class Growth>
+bool operator== (const ft::vector<bool,Alloc,Growth>& lhs, const ft::vector<bool,Alloc,Growth>& rhs)
+{
+	return (lhs.size() == rhs.size()
+		&& (lhs.size() == 0 || std::memcmp(lhs.words(), rhs.words(), (lhs.size() + bits_per_word - 1) / bits_per_word * sizeof(bit_word)) == 0));
+}
+
+template <class Alloc, class Growth>
+bool operator<  (const ft::vector<bool,Alloc,Growth>& lhs, const ft::vector<bool,Alloc,Growth>& rhs)
+{
+	return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+}
+
+#endif
@@ -1,13 +1,14 @@
 #include <iostream>
 #include <string>
-#include <deque>
 
 #if STD //CREATE A REAL STL EXAMPLE
+	#include <deque>
 	#include <map>
 	#include <stack>
 	#include <vector>
 	namespace ft = std;
 #else
+	#include "deque.hpp"
 	#include "map.hpp"
 	#include "stack.hpp"
 	#include "vector.hpp"
@@ -60,7 +61,7 @@ int main(int argc, char** argv) {
 	ft::vector<int> vector_int;
 	ft::stack<int> stack_int;
 	ft::vector<Buffer> vector_buffer;
-	ft::stack<Buffer, std::deque<Buffer> > stack_deq_buffer;
+	ft::stack<Buffer, ft::deque<Buffer> > stack_deq_buffer;
 	ft::map<int, int> map_int;
 
 	for (int i = 0; i < COUNT2; i++)
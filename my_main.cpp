@@ -15,7 +15,18 @@ using namespace std;
 	#include "map.hpp"
 	#include "stack.hpp"
 	#include "vector.hpp"
+	#include "small_vector.hpp"
+	#include "flat_map.hpp"
+	#include "unordered_map.hpp"
+	#include "btree_map.hpp"
 using namespace ft;
+
+//every key probes from the last group on, through the sentinel and the
+//control bytes cloned after it, and all keys share one probe sequence
+struct wrapping_hash
+{
+	std::size_t	operator()( int k ) const { return ((~std::size_t(0) << 7) | (static_cast<std::size_t>(k) & 0x7F)); }
+};
 #endif
 
 # define RED "\033[38;5;124m"
@@ -27,6 +38,21 @@ using namespace ft;
 # define LIGHTBLUE "\033[38;5;87m"
 # define YELLOW "\033[38;5;220m"
 # define DEV "\033[38;5;200m"
+//wide enough that a btree_map node only holds 4 of them, a few dozen keys
+//already make a tree of several levels
+struct wide_key
+{
+	int		value;
+	char	padding[124];
+
+	wide_key( int v = 0 ) : value(v) {}
+	bool	operator<( wide_key const & rhs ) const { return (value < rhs.value); }
+	bool	operator==( wide_key const & rhs ) const { return (value == rhs.value); }
+	bool	operator!=( wide_key const & rhs ) const { return (value != rhs.value); }
+};
+
+std::ostream &	operator<<( std::ostream & o, wide_key const & k ) { return (o << k.value); }
+
 # define ERR_NO_NUM -1
 # define ERR_NO_MEM -2
 
@@ -49,6 +75,163 @@ void printVector( vector<T> const & vec, std::string name = std::string())
 	std::cout << "<--------  " << YELLOW << "END OF PRINT" << RESET << "   ---------->" << std::endl << std::endl;
 }
 
+//same print for any sequence, the ft-only containers print like their std stand-in
+template <typename C>
+void printSequence( C const & c, std::string name )
+{
+	std::cout << DEV << name << RESET << " (" << c.size() << ") : ";
+	for (typename C::const_iterator it = c.begin(); it != c.end(); it++)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+}
+
+template <typename M>
+void printPairs( M const & m, std::string name )
+{
+	std::cout << DEV << name << RESET << " (" << m.size() << ") : ";
+	for (typename M::const_iterator it = m.begin(); it != m.end(); it++)
+		std::cout << it->first << "=" << it->second << " ";
+	std::cout << std::endl;
+}
+
+//counted by hand, any iterator category works
+template <typename C, typename It>
+long positionOf( C const & c, It pos )
+{
+	long	n = 0;
+
+	for (typename C::const_iterator it = c.begin(); it != pos; it++)
+		n++;
+	return (n);
+}
+
+//lower_bound and upper_bound positions around and on every key of m
+template <typename M>
+void printBounds( M const & m, std::string name )
+{
+	std::cout << DEV << name << RESET << " bounds :";
+	for (int k = 0; k != 6; k++)
+		std::cout << " [" << k << "] " << positionOf(m, m.lower_bound(k)) << "/" << positionOf(m, m.upper_bound(k));
+	std::cout << std::endl;
+}
+
+//walks m once, every element has to come up exactly once whatever the order.
+//what was seen is printed sorted, or as a digest when there is a lot of it
+template <typename M>
+void printUnordered( M const & m, std::string name, bool full = true )
+{
+	map<int, int>	seen;
+	std::size_t		visits = 0;
+	long			digest = 0;
+
+	for (typename M::const_iterator it = m.begin(); it != m.end(); it++, visits++)
+	{
+		if (!seen.insert(make_pair(it->first, it->second)).second)
+			std::cout << RED << name << ": " << it->first << " visited twice" << RESET << std::endl;
+		if (m.find(it->first) != it)
+			std::cout << RED << name << ": " << it->first << " not found where it was visited" << RESET << std::endl;
+	}
+	if (visits != m.size())
+		std::cout << RED << name << ": " << visits << " visits for " << m.size() << " elements" << RESET << std::endl;
+	if (full)
+	{
+		printPairs(seen, name);
+		return ;
+	}
+	for (map<int, int>::iterator it = seen.begin(); it != seen.end(); it++)
+		digest = (digest * 31 + it->first * 7 + it->second) % 1000000007;
+	std::cout << DEV << name << RESET << " (" << m.size() << ") digest " << digest << std::endl;
+}
+
+//m walked both ways has to give size() keys in strictly increasing order
+template <typename M>
+void printWalks( M const & m, std::string name )
+{
+	long	forward = 0;
+	long	backward = 0;
+	long	digest = 0;
+	bool	sorted = true;
+
+	for (typename M::const_iterator it = m.begin(); it != m.end(); it++, forward++)
+	{
+		typename M::const_iterator	next = it;
+
+		if (++next != m.end() && !(it->first < next->first))
+			sorted = false;
+		digest = (digest * 31 + it->first.value * 7 + it->second) % 1000000007;
+	}
+	for (typename M::const_reverse_iterator it = m.rbegin(); it != m.rend(); it++)
+		backward++;
+	std::cout << DEV << name << RESET << " size " << m.size() << ", forward " << forward << ", backward " << backward
+		<< (sorted ? ", sorted" : ", NOT SORTED") << ", digest " << digest;
+	if (!m.empty())
+		std::cout << ", first " << m.begin()->first << ", last " << m.rbegin()->first;
+	std::cout << std::endl;
+}
+
+#if STD
+//std::map has no order statistics, the std run counts them with iterators
+template <typename M>
+typename M::const_iterator	mapNth( M const & m, std::size_t k )
+{
+	typename M::const_iterator	it = m.begin();
+
+	if (k >= m.size())
+		return (m.end());
+	std::advance(it, k);
+	return (it);
+}
+
+template <typename M>
+std::size_t	mapRank( M const & m, int k ) { return (std::distance(m.begin(), m.lower_bound(k))); }
+
+template <typename M>
+std::size_t	mapCountRange( M const & m, int lo, int hi ) { return (lo < hi ? std::distance(m.lower_bound(lo), m.lower_bound(hi)) : 0); }
+
+template <typename M>
+std::size_t	mapIndexOf( M const & m, typename M::const_iterator it ) { return (std::distance(m.begin(), it)); }
+#else
+template <typename M>
+typename M::const_iterator	mapNth( M const & m, std::size_t k ) { return (m.nth(k)); }
+
+template <typename M>
+std::size_t	mapRank( M const & m, int k ) { return (m.rank(k)); }
+
+template <typename M>
+std::size_t	mapCountRange( M const & m, int lo, int hi ) { return (m.count_range(lo, hi)); }
+
+template <typename M>
+std::size_t	mapIndexOf( M const & m, typename M::const_iterator it ) { return (m.index_of(it)); }
+#endif
+
+//every index, every key around the ones in m and a grid of ranges
+template <typename M>
+void printOrderStatistics( M const & m, std::string name )
+{
+	long	nth_digest = 0;
+	long	rank_digest = 0;
+	long	range_digest = 0;
+	long	index_digest = 0;
+
+	for (std::size_t k = 0; k != m.size(); k++)
+		nth_digest = (nth_digest * 31 + mapNth(m, k)->first) % 1000000007;
+	for (int k = -2; k != 1002; k++)
+		rank_digest = (rank_digest * 31 + static_cast<long>(mapRank(m, k))) % 1000000007;
+	for (int lo = -1; lo < 1001; lo += 37)
+		for (int hi = -1; hi < 1001; hi += 53)
+			range_digest = (range_digest * 31 + static_cast<long>(mapCountRange(m, lo, hi))) % 1000000007;
+	for (typename M::const_iterator it = m.begin(); it != m.end(); it++)
+		index_digest = (index_digest * 31 + static_cast<long>(mapIndexOf(m, it))) % 1000000007;
+	std::cout << DEV << name << RESET << " size " << m.size() << ", nth " << nth_digest << ", rank " << rank_digest
+		<< ", count_range " << range_digest << ", index_of " << index_digest << std::endl;
+	std::cout << "nth(size) is end: " << (mapNth(m, m.size()) == m.end() ? "yes" : "no")
+		<< ", index_of(end) " << mapIndexOf(m, m.end()) << ", rank(500) " << mapRank(m, 500)
+		<< ", count_range(100, 900) " << mapCountRange(m, 100, 900) << ", count_range(900, 100) " << mapCountRange(m, 900, 100);
+	if (!m.empty())
+		std::cout << ", median " << mapNth(m, m.size() / 2)->first;
+	std::cout << std::endl;
+}
+
 int main(void)
 {
 #if STD //CREATE A REAL STL EXAMPLE
@@ -489,4 +672,595 @@ using namespace ft;
 	
 	}
 
+	{
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                        SMALL_VECTOR                         *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		//std has no small_vector, the std run checks the same values on a vector.
+		//the storage checks only print on failure
+#if STD
+		typedef vector<std::string>				small_vec;
+#else
+		typedef small_vector<std::string, 4>	small_vec;
+#endif
+		//long enough not to fit in the string itself, a destroyed one gets caught
+		const char	*words[] = { "zero", "one", "two", "three", "four is a string on the heap", "five", "six", "seven" };
+
+		small_vec	sv1;
+		for (int i = 0; i != 4; i++)
+			sv1.push_back(words[i]);
+		printSequence(sv1, "sv1 full inline");
+#if !STD
+		if (!sv1.is_inline())
+			std::cout << RED << "sv1 spilled before N + 1 elements" << RESET << std::endl;
+#endif
+		sv1.push_back(words[4]);
+		printSequence(sv1, "sv1 spilled");
+#if !STD
+		if (sv1.is_inline())
+			std::cout << RED << "sv1 did not spill" << RESET << std::endl;
+#endif
+
+		small_vec	sv2;
+		sv2.push_back(words[5]);
+		sv2.push_back(words[6]);
+		sv2.push_back(words[7]);
+		sv2.insert(sv2.begin() + 1, 2, sv2[2]);
+		printSequence(sv2, "sv2 insert of its own element across the spill");
+
+		std::cout << std::endl << "ASSIGN FROM AN OWN ELEMENT>" << std::endl;
+		small_vec	sv3(sv1.begin() + 2, sv1.end());
+		sv3.assign(3, sv3[2]);
+		printSequence(sv3, "sv3 inline assign(3, sv3[2])");
+		sv3.assign(6, sv3[0]);
+		printSequence(sv3, "sv3 spilling assign(6, sv3[0])");
+		sv1.assign(2, sv1[4]);
+		printSequence(sv1, "sv1 heap assign(2, sv1[4])");
+
+		std::cout << std::endl << "COPY>" << std::endl;
+		small_vec	inline_src(sv2.begin(), sv2.begin() + 2);
+		small_vec	heap_src(sv2);
+		small_vec	copy_of_inline(inline_src);
+		small_vec	copy_of_heap(heap_src);
+		printSequence(copy_of_inline, "copy of inline");
+		printSequence(copy_of_heap, "copy of heap");
+		copy_of_inline = heap_src;
+		copy_of_heap = inline_src;
+		printSequence(copy_of_inline, "inline = heap");
+		printSequence(copy_of_heap, "heap = inline");
+		small_vec	&same = copy_of_heap;
+		copy_of_heap = same;
+		printSequence(copy_of_heap, "self assignment");
+
+		std::cout << std::endl << "SWAP>" << std::endl;
+		small_vec	a(inline_src);
+		small_vec	b(heap_src);
+		a.swap(b);
+		printSequence(a, "a inline swapped with heap");
+		printSequence(b, "b heap swapped with inline");
+		small_vec	c(inline_src);
+		c.push_back(words[0]);
+		b.swap(c);
+		printSequence(b, "b inline swapped with inline");
+		printSequence(c, "c inline swapped with inline");
+		small_vec	d(sv3);
+		a.swap(d);
+		printSequence(a, "a heap swapped with heap");
+		printSequence(d, "d heap swapped with heap");
+		swap(a, b);
+		printSequence(a, "a after swap(a, b)");
+		printSequence(b, "b after swap(a, b)");
+
+		std::cout << std::endl << "SHRINKING BACK>" << std::endl;
+		small_vec	sv4;
+		for (int i = 0; i != 8; i++)
+			sv4.push_back(words[i]);
+		sv4.erase(sv4.begin() + 1, sv4.begin() + 6);
+		printSequence(sv4, "sv4 erase down to 3");
+		sv4.resize(1);
+		printSequence(sv4, "sv4 resize(1)");
+		sv4.pop_back();
+		printSequence(sv4, "sv4 pop_back");
+		std::cout << "isEmpty?" << (sv4.empty()?"True":"False") << std::endl;
+		for (int i = 7; i != 1; i--)
+			sv4.push_back(words[i]);
+		printSequence(sv4, "sv4 refilled");
+		sv4.resize(9, sv4[0]);
+		printSequence(sv4, "sv4 resize(9, sv4[0])");
+		sv4.clear();
+		printSequence(sv4, "sv4 clear");
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                          FLAT_MAP                           *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		//checked against std::map, which flat_map has to behave like
+#if STD
+		typedef map<int, std::string>		flat_type;
+#else
+		typedef flat_map<int, std::string>	flat_type;
+#endif
+		typedef pair<int, std::string>			entry;
+		typedef vector<entry>					pair_vector;
+
+		std::cout << "BULK LOAD, FIRST OF EQUAL KEYS WINS>" << std::endl;
+		pair_vector	unsorted;
+		int			keys[] = { 7, 3, 9, 3, 1, 7, 5, 9, 9, 2, 1 };
+		for (int i = 0; i != 11; i++)
+		{
+			std::string	tag(1, static_cast<char>('a' + i));
+			unsorted.push_back(entry(keys[i], tag));
+		}
+		flat_type	fm1(unsorted.begin(), unsorted.end());
+		printPairs(fm1, "fm1 range ctor");
+		flat_type	fm2(unsorted.begin(), unsorted.begin() + 1);
+		printPairs(fm2, "fm2 one element");
+		flat_type	fm3(unsorted.begin(), unsorted.begin());
+		printPairs(fm3, "fm3 empty range");
+		flat_type	fm4(unsorted.begin() + 5, unsorted.begin() + 9);
+		printPairs(fm4, "fm4 only duplicates after the first");
+		flat_type	fm1_copy(fm1.begin(), fm1.end());
+		printPairs(fm1_copy, "range ctor from sorted unique input");
+
+		pair_vector	more;
+		more.push_back(entry(9, "new"));
+		more.push_back(entry(4, "new"));
+		more.push_back(entry(0, "new"));
+		more.push_back(entry(4, "newer"));
+		more.push_back(entry(1, "new"));
+		fm1.insert(more.begin(), more.end());
+		printPairs(fm1, "fm1 range insert, old keys stay");
+		fm3.insert(more.begin(), more.end());
+		printPairs(fm3, "fm3 range insert in empty");
+		fm2.insert(more.begin() + 1, more.begin() + 2);
+		printPairs(fm2, "fm2 range insert before everything");
+
+		std::cout << std::endl << "HINTED INSERT>" << std::endl;
+		flat_type	fm5;
+		flat_type::iterator	hint = fm5.insert(fm5.end(), entry(10, "end of empty"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.end(), entry(20, "right hint"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.begin(), entry(5, "begin hint"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.find(20), entry(15, "before 20"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.begin(), entry(30, "wrong hint"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.end(), entry(1, "wrong hint"));
+		std::cout << "returned " << hint->first << std::endl;
+		hint = fm5.insert(fm5.find(15), entry(15, "duplicate"));
+		std::cout << "returned " << hint->first << " " << hint->second << std::endl;
+		hint = fm5.insert(fm5.find(20), entry(10, "duplicate, wrong hint"));
+		std::cout << "returned " << hint->first << " " << hint->second << std::endl;
+		printPairs(fm5, "fm5");
+
+		std::cout << std::endl << "BOUNDS ON TINY MAPS>" << std::endl;
+		flat_type	tiny;
+		printBounds(tiny, "0 element");
+		std::cout << ((tiny.find(1) == tiny.end()) ? "1 not found" : "1 found") << std::endl;
+		tiny[2] = "two";
+		printBounds(tiny, "1 element");
+		tiny[4] = "four";
+		printBounds(tiny, "2 elements");
+		tiny.erase(2);
+		printBounds(tiny, "1 element left");
+		std::cout << "count 4 = " << tiny.count(4) << ", count 2 = " << tiny.count(2) << std::endl;
+		tiny.erase(tiny.begin());
+		printBounds(tiny, "0 element left");
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                        UNORDERED_MAP                        *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		//std::unordered_map is C++11, the std run checks the same content on a
+		//map. Storage checks only print on failure
+#if STD
+		typedef map<int, int>							hash_table;
+		typedef map<int, int>							wrapping_table;
+#else
+		typedef unordered_map<int, int>					hash_table;
+		typedef unordered_map<int, int, wrapping_hash>	wrapping_table;
+#endif
+		unsigned long	seed = 42;
+
+		std::cout << "INSERT/ERASE CHURN>" << std::endl;
+		hash_table	um1;
+		for (int op = 0; op != 20000; op++)
+		{
+			seed = seed * 1103515245UL + 12345UL;
+
+			int	key = static_cast<int>((seed >> 8) % 3000);
+
+			switch ((seed >> 4) % 4)
+			{
+				case 0:
+				case 1:
+					um1.insert(make_pair(key, op));
+					break ;
+				case 2:
+					um1[key] += 1;
+					break ;
+				default:
+					um1.erase(key);
+			}
+			if (op % 5000 == 4999)
+				printUnordered(um1, "um1 after churn", false);
+		}
+		hash_table	um2(um1);
+		printUnordered(um2, "um2 copy of um1", false);
+		std::cout << ((um1 == um2) ? "um1 == um2" : "um1 != um2") << std::endl;
+		um2.erase(um2.begin());
+		std::cout << ((um1 != um2) ? "um1 != um2" : "um1 == um2") << std::endl;
+		um2.clear();
+		printUnordered(um2, "um2 cleared");
+		for (int i = 30; i != 0; i--)
+			um2[i] = i;
+		hash_table	um3;
+		for (int i = 1; i != 31; i++)
+			um3.insert(make_pair(i, i));
+		std::cout << ((um2 == um3) ? "same content inserted in another order is equal" : "order changed equality") << std::endl;
+
+		std::cout << std::endl << "ONE PROBE SEQUENCE THROUGH THE CLONED BYTES>" << std::endl;
+		wrapping_table	wt;
+		for (int i = 0; i != 40; i++)
+			wt[i * 3] = i;
+		printUnordered(wt, "wt 40 keys");
+		for (int i = 0; i < 120; i += 9)
+			wt.erase(i);
+		printUnordered(wt, "wt erased in the middle of the probe");
+		for (int i = 0; i != 120; i++)
+			if (wt.count(i) != static_cast<std::size_t>(i % 3 == 0 && i % 9 != 0))
+				std::cout << RED << "wt count(" << i << ") is wrong" << RESET << std::endl;
+
+		std::cout << std::endl << "TOMBSTONE REUSE>" << std::endl;
+#if !STD
+		std::size_t	buckets = wt.bucket_count();
+#endif
+		//oldest key out, a new one in: the erased slots are tombstones
+		vector<int>	fifo;
+		for (int i = 0; i < 120; i++)
+			if (wt.count(i))
+				fifo.push_back(i);
+		for (int i = 0; i != 2000; i++)
+		{
+			wt.erase(fifo[i]);
+			wt[1000 + i] = i;
+			fifo.push_back(1000 + i);
+		}
+		printUnordered(wt, "wt after 2000 erase and insert", false);
+#if !STD
+		if (wt.bucket_count() > buckets)
+			std::cout << RED << "wt grew while its size stayed the same" << RESET << std::endl;
+#endif
+		wrapping_table	wt2;
+		wt2[1] = 1;
+		for (int i = 0; i != 2000; i++)
+		{
+			wt2.erase(1);
+			wt2[1] = i;
+		}
+		printUnordered(wt2, "wt2 one key erased and inserted again");
+
+		std::cout << std::endl << "LOAD FACTOR, REHASH AND RESERVE>" << std::endl;
+		hash_table	um4;
+#if !STD
+		um4.rehash(0);
+		if (um4.bucket_count() != 0)
+			std::cout << RED << "rehash(0) of an empty table kept its slots" << RESET << std::endl;
+		um4.reserve(100);
+		std::size_t	reserved = um4.bucket_count();
+		if (reserved * um4.max_load_factor() < 100)
+			std::cout << RED << "reserve(100) is too small" << RESET << std::endl;
+#endif
+		for (int i = 0; i != 100; i++)
+			um4[i * 7] = i;
+		printUnordered(um4, "um4 100 reserved keys", false);
+#if !STD
+		if (um4.bucket_count() != reserved)
+			std::cout << RED << "um4 rehashed within what it reserved" << RESET << std::endl;
+		um4.max_load_factor(0.25f);
+		if (um4.load_factor() > 0.25f)
+			std::cout << RED << "max_load_factor(0.25) not honored" << RESET << std::endl;
+		for (int i = 100; i != 300; i++)
+			um4[i * 7] = i;
+		if (um4.load_factor() > 0.25f)
+			std::cout << RED << "load factor went over 0.25" << RESET << std::endl;
+		um4.max_load_factor(1.0f);
+		um4.rehash(5000);
+		if (um4.bucket_count() < 5000)
+			std::cout << RED << "rehash(5000) is too small" << RESET << std::endl;
+		um4.rehash(0);
+		if (um4.bucket_count() < um4.size() || um4.load_factor() < 0.25f)
+			std::cout << RED << "rehash(0) did not fit the size" << RESET << std::endl;
+		try
+		{
+			um4.max_load_factor(1.5f);
+			std::cout << RED << "max_load_factor(1.5) accepted" << RESET << std::endl;
+		}
+		catch (const std::invalid_argument &) {}
+#else
+		for (int i = 100; i != 300; i++)
+			um4[i * 7] = i;
+#endif
+		printUnordered(um4, "um4 after the rehashes", false);
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                         BTREE_MAP                           *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		//same steps as the MAP section, checked against std::map
+#if STD
+		typedef map<wide_key, int>			tree_type;
+		typedef map<int, int>				int_tree_type;
+#else
+		typedef btree_map<wide_key, int>	tree_type;
+		typedef btree_map<int, int>			int_tree_type;
+#endif
+		typedef pair<wide_key, int>			tree_entry;
+		unsigned long	seed = 4242;
+
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                   CREATION-DESTRUCTION                      *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		tree_type	bt1;
+		std::cout << "isEmpty?" << (bt1.empty()?"True":"False") << std::endl;
+		printWalks(bt1, "bt1 empty");
+
+		vector<tree_entry>	unsorted;
+		vector<tree_entry>	sorted;
+		for (int i = 0; i != 60; i++)
+		{
+			seed = seed * 1103515245UL + 12345UL;
+			unsorted.push_back(tree_entry(static_cast<int>((seed >> 8) % 40), i));
+			sorted.push_back(tree_entry(i * 2, i));
+		}
+		tree_type	bt2(unsorted.begin(), unsorted.end());
+		printPairs(bt2, "bt2 unsorted range with duplicates");
+		tree_type	bt3(sorted.begin(), sorted.end());
+		printWalks(bt3, "bt3 sorted range");
+		tree_type	bt4(bt3);
+		printWalks(bt4, "bt4 copy of bt3");
+		bt1 = bt2;
+		printWalks(bt1, "bt1 = bt2");
+
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                      INSERTION-ERASURE                      *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		std::cout << "DIFFERENT TYPES OF INSERT>" << std::endl;
+		tree_type	bt5;
+		vector<int>	order;
+		for (int i = 0; i != 2000; i++)
+			order.push_back(i);
+		for (int i = 1999; i > 0; i--)
+		{
+			seed = seed * 1103515245UL + 12345UL;
+			std::swap(order[i], order[(seed >> 8) % (i + 1)]);
+		}
+		for (int i = 0; i != 2000; i++)
+		{
+			if (i % 3 == 0)
+				bt5.insert(tree_entry(order[i], i));
+			else if (i % 3 == 1)
+				bt5[order[i]] = i;
+			else
+				bt5.insert(bt5.end(), tree_entry(order[i], i));
+		}
+		printWalks(bt5, "bt5 2000 shuffled keys");
+		std::cout << "insert of 10 again: " << (bt5.insert(tree_entry(10, -1)).second ? "inserted" : "kept") << " " << bt5[10] << std::endl;
+		tree_type::iterator	hinted = bt5.insert(bt5.find(500), tree_entry(500, -1));
+		std::cout << "hinted insert of 500 again: " << hinted->first << " " << hinted->second << std::endl;
+		for (int i = 2000; i != 2100; i++)
+			bt5.insert(bt5.end(), tree_entry(i, i));
+		for (int i = -1; i != -101; i--)
+			bt5.insert(bt5.begin(), tree_entry(i, i));
+		printWalks(bt5, "bt5 hinted at both ends");
+
+		std::cout << std::endl << "DIFFERENT TYPES OF ERASE>" << std::endl;
+		std::cout << "erase 5000: " << bt5.erase(5000) << ", erase 7: " << bt5.erase(7) << std::endl;
+		for (int i = 0; i < 2000; i += 2)
+			bt5.erase(i);
+		printWalks(bt5, "bt5 every other key, leaves underflow");
+		bt5.erase(bt5.find(1001), bt5.find(1601));
+		printWalks(bt5, "bt5 range in the middle, inner nodes merge");
+		for (int i = -100; i != 200; i++)
+			bt5.erase(i);
+		printWalks(bt5, "bt5 from the front");
+		for (int i = 2099; i != 1900; i--)
+			bt5.erase(i);
+		printWalks(bt5, "bt5 from the back");
+		bt5.erase(bt5.begin());
+		bt5.erase(--bt5.end());
+		printWalks(bt5, "bt5 first and last iterator");
+		while (bt5.size() > 1)
+			bt5.erase(bt5.lower_bound(bt5.begin()->first.value + static_cast<int>(bt5.size() % 7)));
+		printWalks(bt5, "bt5 down to the root leaf");
+		bt5.erase(bt5.begin()->first);
+		printWalks(bt5, "bt5 empty again");
+		bt5[3] = 3;
+		printWalks(bt5, "bt5 reused");
+
+		std::cout << std::endl << "DEFAULT NODE SIZES>" << std::endl;
+		int_tree_type	big;
+		for (int i = 0; i != 20000; i++)
+		{
+			seed = seed * 1103515245UL + 12345UL;
+			big[static_cast<int>((seed >> 8) % 40000)] = i;
+		}
+		std::cout << "big size " << big.size() << std::endl;
+		for (int i = 0; i != 40000; i++)
+			if (i % 5 != 0)
+				big.erase(i);
+		std::cout << "big size " << big.size() << ", first " << big.begin()->first << ", last " << big.rbegin()->first << std::endl;
+		long	sum = 0;
+		for (int_tree_type::iterator it = big.begin(); it != big.end(); it++)
+			sum += it->first % 1000 + it->second % 1000;
+		std::cout << "big sum " << sum << std::endl;
+		big.erase(big.begin(), big.find(39000));
+		std::cout << "big size " << big.size() << ", first " << big.begin()->first << std::endl;
+
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                     ITERATORS-BOUNDS                        *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		tree_type::iterator	it = bt3.begin();
+		--(++it);
+		(it++)--;
+		std::cout << "begin " << it->first << ", last " << (--bt3.end())->first << std::endl;
+		for (int i = 0; i != 40; i++)
+			it++;
+		for (int i = 0; i != 20; i++)
+			it--;
+		std::cout << "20 forward " << it->first << std::endl;
+		tree_type::reverse_iterator	ti = bt3.rbegin();
+		for (int i = 0; i != 10; i++, ti++)
+			std::cout << ti->first << " " << GREEN << ti->second << RESET << " ";
+		std::cout << std::endl;
+		for (int k = -1; k != 124; k += 25)
+		{
+			std::cout << "[" << k << "] lower " << positionOf(bt3, bt3.lower_bound(k)) << " upper " << positionOf(bt3, bt3.upper_bound(k))
+				<< " count " << bt3.count(k) << " equal_range " << positionOf(bt3, bt3.equal_range(k).first)
+				<< "-" << positionOf(bt3, bt3.equal_range(k).second) << std::endl;
+		}
+
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                            SWAP                             *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		tree_type	empty1;
+		tree_type	empty2;
+		empty1.swap(empty2);
+		printWalks(empty1, "empty swapped with empty");
+		empty1.swap(bt4);
+		printWalks(empty1, "empty swapped with bt4");
+		printWalks(bt4, "bt4 swapped with empty");
+		empty1.swap(bt4);
+		printWalks(empty1, "swapped back");
+		printWalks(bt4, "bt4 swapped back");
+		bt4.swap(bt2);
+		printWalks(bt4, "bt4 swapped with bt2");
+		printWalks(bt2, "bt2 swapped with bt4");
+		swap(bt4, bt2);
+		printWalks(bt4, "bt4 after swap(bt4, bt2)");
+		printWalks(bt2, "bt2 after swap(bt4, bt2)");
+		bt4[1000] = 1;
+		bt2.erase(bt2.begin());
+		empty1[1000] = 1;
+		printWalks(bt4, "bt4 still usable");
+		printWalks(bt2, "bt2 still usable");
+		printWalks(empty1, "emptied one still usable");
+
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                    RELATIONAL OPERATORS                     *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		bt1 = bt3;
+		std::cout << ((bt1 == bt3)? "bt1 is equal to bt3": "bt1 is not equal to bt3") << std::endl;
+		std::cout << ((bt1 < bt3)? "bt1 is inf to bt3": "bt1 is not inf to bt3") << std::endl;
+		std::cout << ((bt1 >= bt3)? "bt1 is sup or equal to bt3": "bt1 is not sup or equal to bt3") << std::endl;
+		bt1[1000] = 0;
+		std::cout << ((bt1 != bt3)? "bt1 is not equal to bt3": "bt1 is equal to bt3") << std::endl;
+		std::cout << ((bt1 > bt3)? "bt1 is sup to bt3": "bt1 is not sup to bt3") << std::endl;
+		std::cout << ((bt1 <= bt3)? "bt1 is inf or equal to bt3": "bt1 is not inf or equal to bt3") << std::endl;
+		bt1[0] = -1;
+		std::cout << ((bt1 < bt3)? "bt1 is inf to bt3": "bt1 is not inf to bt3") << std::endl;
+
+		std::cout << "CLEARING OUT BTREE_MAP" << std::endl;
+		bt1.clear();
+		printWalks(bt1, "bt1 cleared");
+		bt1.insert(sorted.begin(), sorted.begin() + 5);
+		printPairs(bt1, "bt1 after clear");
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "%*************************************************************%" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "*                    MAP ORDER STATISTICS                     *" << std::endl;
+		std::cout << "*                                                             *" << std::endl;
+		std::cout << "%*************************************************************%" << std::endl << std::endl;
+
+		//nth, rank, count_range and index_of after every kind of insert and
+		//erase, the std run counts the same with std::distance
+		map<int, int>	os;
+		unsigned long	seed = 2525;
+
+		printOrderStatistics(os, "os empty");
+		os[500] = 0;
+		printOrderStatistics(os, "os one key");
+		os.erase(500);
+		printOrderStatistics(os, "os erased back to empty");
+		for (int round = 0; round != 5; round++)
+		{
+			for (int op = 0; op != 3000; op++)
+			{
+				seed = seed * 1103515245UL + 12345UL;
+
+				int	key = static_cast<int>((seed >> 8) % 1000);
+
+				switch ((seed >> 4) % 5)
+				{
+					case 0:
+						os.erase(key);
+						break ;
+					case 1:
+						os.insert(os.lower_bound(key), make_pair(key, op));
+						break ;
+					case 2:
+						os.insert(make_pair(key, op));
+						break ;
+					default:
+						os[key] = op;
+				}
+			}
+			printOrderStatistics(os, "os after mixed inserts and erases");
+			if (round == 1)
+			{
+				os.erase(os.lower_bound(200), os.lower_bound(400));
+				printOrderStatistics(os, "os range erased");
+			}
+			if (round == 3)
+			{
+				for (int k = 0; k != 1000; k += 2)
+					os.erase(os.find(k) == os.end() ? os.begin() : os.find(k));
+				printOrderStatistics(os, "os iterator erased");
+			}
+		}
+		map<int, int>	os_copy(os);
+		printOrderStatistics(os_copy, "copy of os");
+		os.clear();
+		printOrderStatistics(os, "os cleared");
+		std::cout << std::endl;
+	}
+
 }